@@ -1,1001 +1,2154 @@
-/*****************************************************************************
-   Project: CEDAR Logic Simulator
-   Copyright 2006 Cedarville University, Benjamin Sprague,
-                     Matt Lewellyn, and David Knierim
-   All rights reserved.
-   For license information see license.txt included with distribution.   
-*****************************************************************************/
-
-// logic_circuit.cpp: implementation of the Circuit class.
-//
-//////////////////////////////////////////////////////////////////////
-
-#include "logic_circuit.h"
-#include <iostream>
-#include <algorithm>
-#include <stack>
-
-#include "../Z80/Z_80LogicGate.h"
-
-#ifndef _PRODUCTION_
-ofstream* logiclog;
-#endif
-
-// ************************** Event class ********************************
-unsigned long long Event::globalCreationTime = 0;
-
-// Definition of operator for Events:
-bool operator >(const Event &left, const Event &right) {
-	if(left.eventTime == right.eventTime) {
-		return(left.getCreationTime() > right.getCreationTime());
-	} else {
-		return(left.eventTime > right.eventTime);
-	}
-}
-
-// ************************** End Event class ********************************
-
-
-// If this is defined, use inertial delay, otherwise default to transport delay
-//#define INERTIAL_DELAY
-
-
-//////////////////////////////////////////////////////////////////////
-// Construction/Destruction
-//////////////////////////////////////////////////////////////////////
-
-Circuit::Circuit()
-{
-	// Set time to begin starting:
-	systemTime = 0;
-	
-	// Set the initial ID values:
-	gateIDCount = 0;
-	wireIDCount = 0;
-	juncIDCount = 0;
-	
-#ifndef _PRODUCTION_
-	logiclog = new ofstream("corelog.log");
-#endif
-}
-
-Circuit::~Circuit()
-{
-	// Cause all of the gates to destroy themselves
-	// before the Circuit gets destroyed, or any other
-	// objects are removed:
-	//(This is needed so that if their destructors call
-	// any Circuit methods, they won't crash.)
-
-	gateList.clear();
-}
-
-// **************** The visible interface of the circuit ********************
-
-// ********** Circuit input methods *************
-
-//***************************************
-//Edit by Joshua Lansford 3/27/07
-//purpose of edit: The ram gate needs to
-//update its pop-up right after it loads
-//even if it is paused.  Thus this method
-//is created, so that the pop-ups
-//can request that the core proces
-//thegateUpdateList without advanceing
-//the system time
-void Circuit::stepOnlyGates(){
-	// Update the gates that have been connected or disconnected or had a 
-	// parameter change within the last call to step() so that they can
-	// recalculate correctly:
-	ID_SET< IDType >::iterator updateGate = gateUpdateList.begin();
-	while(updateGate != gateUpdateList.end()) {
-		gateList[*updateGate]->updateGate(*updateGate, this);
-		updateGate++;
-	}
-	gateUpdateList.clear();
-}
-//End of Edit*****************************
-
-
-// Step the simulation forward by one timestep:
-// If a pointer to a set is passed, then it will
-// return a set of all the changed wires to the calling function.
-void Circuit::step(ID_SET< IDType > *changedWires)
-{
-	// NOTE: Should activate the polled gates here:
-	// Basically just loop through the things in polledGates and call updateGate() on them.
-	ID_SET< IDType >::iterator gateToPoll = polledGates.begin();
-	while(gateToPoll != polledGates.end()) {
-		gateList[*gateToPoll]->updateGate(*gateToPoll, this);
-		gateToPoll++;
-	}
-
-	// Update the gates that have been connected or disconnected or had a 
-	// parameter change within the last call to step() so that they can
-	// recalculate correctly:
-	ID_SET< IDType >::iterator updateGate = gateUpdateList.begin();
-	while(updateGate != gateUpdateList.end()) {
-		gateList[*updateGate]->updateGate(*updateGate, this);
-		updateGate++;
-	}
-	gateUpdateList.clear();
-
-	// Loop through all of the events with time == now, and 
-	// activate them.
-	bool makeYourOwnFreakinChangedWiresList =(changedWires == NULL);
-	
-	if(makeYourOwnFreakinChangedWiresList)
-		changedWires = new ID_SET< IDType >;
-
-	int processedEvents = 0;
-	Event myEvent;
-	if(!eventQueue.empty()) myEvent = eventQueue.top();
-	while(!eventQueue.empty() && (myEvent.eventTime <= systemTime)) {
-		// Pop the event off of the event queue:
-		eventQueue.pop();
-		
-		// If the event is a junction event, handle it as a junction:
-		if(myEvent.isJunctionEvent) {
-			// Handle the junction event:
-			setJunctionState(myEvent.junctionID, myEvent.newJunctionState);
-
-			// Also adds all of the wires hooked up to this junction to
-			// the "wireUpdateList" list.
-			//(Handled inside of a setJunctionState() method, to allow
-			// it to be called from outside of an event handle - for zero delay.)
-		} else {
-			// Else, make the event happen to the wire:
-			WIRE_PTR myWire = wireList[myEvent.wireID];
-			myWire->setInputState(myEvent.gateID, myEvent.gateOutputID, myEvent.newState);
-
-			// Insert all attached wires into the changed wires list:
-			set< IDType > wireGroup = getJunctionGroupIDs(myEvent.wireID);
-			changedWires->insert(wireGroup.begin(), wireGroup.end());
-		}
-		
-		// Look at the next thing in the list:
-		myEvent = eventQueue.top();
-		
-		processedEvents++;
-	}
-	
-	// Insert the wires that have been disconnected(or were part of a junction that changed) within
-	// the last call to step() so that they will be properly updated:
-	changedWires->insert(wireUpdateList.begin(), wireUpdateList.end());
-	wireUpdateList.clear();	// Empty the wireUpdateList, since we are handling the updates.
-	
-
-	// Calculate the new wire states, and make a list of affected gates:
-	ID_SET< IDType > changedGates;
-	vector< IDType > affectedGates;
-
-	// This keeps track of wires that share junctions that have already
-	// calculated their state:
-	ID_SET< IDType > doneWires;
-	ID_SET< IDType >::iterator chgWireIterator = changedWires->begin();
-	while(chgWireIterator != changedWires->end()) {
-		WIRE_PTR myWire = wireList[*chgWireIterator];
-		
-		// Calculate the new state of a wire:
-		//(Note: It sends the group of attached wires to the Wire::calculateState() method.
-		if(doneWires.find( *chgWireIterator) == doneWires.end() ) {
-			set< IDType > wireGroupIDs = getJunctionGroupIDs(*chgWireIterator);
-			set< WIRE_PTR > wireGroup = getJunctionGroup(&wireGroupIDs);
-			StateType juncState = myWire->calculateState(wireGroup);
-			
-			set< WIRE_PTR >::iterator wgWire = wireGroup.begin();
-			while(wgWire != wireGroup.end()) {
-				(*wgWire)->forceState(juncState);
-				wgWire++;
-			}
-			
-			doneWires.insert(wireGroupIDs.begin(), wireGroupIDs.end());
-		}
-		
-		// Add this wire's gates to the overall gate list:
-		affectedGates = myWire->getOutputGates();
-		changedGates.insert(affectedGates.begin(), affectedGates.end());
-		// NOTE: Aparently MSVCC doesn't like this last *STL standard and legal* line
-		// of code.
-		
-		// Move on to the next wire in the list:
-		chgWireIterator++;
-	}
-	
-	// Update the gate's states and post the events from the gates:
-	ID_SET< IDType >::iterator changedGatesIterator = changedGates.begin();
-	
-
-	// Update all of the gates and retrieve the events from them:
-	while(changedGatesIterator != changedGates.end()) {
-		GATE_PTR myGate = gateList[*changedGatesIterator];
-		
-		myGate->updateGate(*changedGatesIterator, this);
-		
-		changedGatesIterator++;
-	}
-
-	// Increment the system timer, because this timestep is complete:
-	systemTime++;
-	
-	// Remove the changedWiresList if we created it ourselves:
-	if(makeYourOwnFreakinChangedWiresList)
-		delete changedWires;
-} // step()
-
-
-// Create a new gate, and return its ID:
-IDType Circuit::newGate(string type, IDType gateID) {
-	IDType thisGateID;
-
-	if(gateID == ID_NONE) {
-		// If no ID is specified for the new gate, then generate one:
-		thisGateID = gateIDCount;
-		gateIDCount++;
-	} else {
-		// Otherwise use the one given and make sure that the ID is not
-		// ever re-used for a generated ID:
-		thisGateID = gateID;
-		gateIDCount = max(gateID + 1, gateIDCount);
-	}
-
-	// If the gate isn't already created, then make it:
-	if(gateList.find(thisGateID)== gateList.end()) {
-
-		// Create a gate of the proper type:
-		if(type == "AND") {
-			gateList[thisGateID] = GATE_PTR(new Gate_AND);
-		} else if(type == "OR") {
-			gateList[thisGateID] = GATE_PTR(new Gate_OR);
-		} else if(type == "XOR") {
-			gateList[thisGateID] = GATE_PTR(new Gate_XOR);
-		} else if(type == "BUFFER") {
-			gateList[thisGateID] = GATE_PTR(new Gate_PASS);
-		} else if(type == "MUX") {
-			gateList[thisGateID] = GATE_PTR(new Gate_MUX);
-		} else if(type == "DECODER") {
-			gateList[thisGateID] = GATE_PTR(new Gate_DECODER);
-		} else if(type == "CLOCK") {
-			gateList[thisGateID] = GATE_PTR(new Gate_CLOCK);
-			// This is a polled gate, so insert it into the polled gates queue!
-			polledGates.insert(thisGateID);
-		} else if(type == "PULSE") {
-			gateList[thisGateID] = GATE_PTR(new Gate_PULSE);
-			// This is a polled gate, so insert it into the polled gates queue!
-			polledGates.insert(thisGateID);
-		} else if(type == "DRIVER") {
-			gateList[thisGateID] = GATE_PTR(new Gate_DRIVER);
-		} else if(type == "ADDER") {
-			gateList[thisGateID] = GATE_PTR(new Gate_ADDER);
-		} else if(type == "COMPARE") {
-			gateList[thisGateID] = GATE_PTR(new Gate_COMPARE);
-		} else if(type == "JKFF") {
-			gateList[thisGateID] = GATE_PTR(new Gate_JKFF);
-		} else if(type == "RAM") {
-			gateList[thisGateID] = GATE_PTR(new Gate_RAM);
-		} else if(type == "REGISTER") {
-			gateList[thisGateID] = GATE_PTR(new Gate_REGISTER);
-		} else if((type == "FROM") || ( type == "TO" ) ) {
-			gateList[thisGateID] = GATE_PTR(new Gate_JUNCTION( this) );
-		} else if(type == "TGATE") {
-			gateList[thisGateID] = GATE_PTR(new Gate_T( this) );
-		} else if(type == "NODE") {
-			gateList[thisGateID] = GATE_PTR(new Gate_NODE( this) );
-		} else if(type == "EQUIVALENCE") {
-			gateList[thisGateID] = GATE_PTR(new Gate_EQUIVALENCE);
-//*******************************************************************
-//  Edit by Joshua Lansford 1/22/06
-//  This edit is added because Nathan Harro and I are adding a new
-//  gate type!!
-		} else if(type == "Z80"){
-			gateList[thisGateID] = GATE_PTR(new Z_80LogicGate());
-// End of edit*******************************************************
-
-//********************************
-//  Edit by Joshua Lansford 4/10/07
-//  now adding the ADC
-		} else if(type == "ADC"){
-			gateList[thisGateID] = GATE_PTR(new Gate_ADC());
-// End of edit********************
-
-//********************************
-//  Edit by Joshua Lansford 6/05/07
-//  now adding the pauseulator
-		} else if(type == "Pauseulator"){
-			gateList[thisGateID] = GATE_PTR(new Gate_pauseulator());
-// End of edit*******************
-
-		} else {
-			WARNING("Circuit::newGate() - Invalid logic type!");
-		}
-
-	} else {
-		WARNING("Circuit::newGate() - Re-used gate ID!");
-	}
-	
-	// Always initialize the non-polled gates, so that it drives some value:
-//NOTE: Crashed the small computer file for some reason.
-//	if(polledGates.find( thisGateID) == polledGates.end() ) {
-//		gateUpdateList.insert(gateID);
-//	}
-	
-	return thisGateID;
-}
-
-	
-// Create a new wire and return its ID:
-IDType Circuit::newWire(IDType wireID) {
-	IDType thisWireID;
-	WIRE_PTR myWire(new Wire);
-	
-	if(wireID == ID_NONE) {
-		// If no ID is specified for the new wire, then generate one:
-		thisWireID = wireIDCount;
-		wireIDCount++;
-	} else {
-		// Otherwise use the one given and make sure that the ID is not
-		// ever re-used for a generated ID:
-		thisWireID = wireID;
-		wireIDCount = max(wireID + 1, wireIDCount);
-	}
-	
-	// If the wire isn't already created, then make it:
-	if(wireList.find(thisWireID) == wireList.end()) {
-		wireList[thisWireID] = myWire;
-	} else {
-		WARNING("Circuit::newWire() - Re-used wire ID!");
-	}
-	
-	return thisWireID;
-}
-
-
-// Create a new junction and return its ID:
-IDType Circuit::newJunction(IDType juncID ) {
-	IDType thisJuncID;
-	
-	if(juncID == ID_NONE) {
-		// If no ID is specified for the new junction, then generate one:
-		thisJuncID = juncIDCount;
-		juncIDCount++;
-	} else {
-		// Otherwise use the one given and make sure that the ID is not
-		// ever re-used for a generated ID:
-		thisJuncID = juncID;
-		juncIDCount = max(juncID + 1, juncIDCount);
-	}
-
-	JUNC_PTR myJunc(new Junction(thisJuncID));
-
-	// If the junction isn't already created, then make it:
-	if(juncList.find(thisJuncID) == juncList.end()) {
-		juncList[thisJuncID] = myJunc;
-	} else {
-		WARNING("Circuit::newJunction() - Re-used junction ID!");
-	}
-	
-	return thisJuncID;
-}
-
-
-
-// Delete a gate, removing its connections to wires first:
-void Circuit::deleteGate(IDType theGate) {
-	if(gateList.find( theGate) == gateList.end() ) {
-		WARNING("Circuit::deleteGate() - Invalid gate ID.");
-		return;
-	}
-	GATE_PTR myGate = gateList[ theGate ];
-	
-	// Delete the gate's inputs:
-	while(myGate->getFirstConnectedInput() != "") {
-		disconnectGateInput(theGate, myGate->getFirstConnectedInput());
-	}
-
-	// Remove the gate from the update list, since disconnectGateInput()
-	// will add it, and we don't want it updating after it's gone!
-	gateUpdateList.erase(theGate);
-
-	// Delete the gate's outputs:
-	while(myGate->getFirstConnectedOutput() != "") {
-		disconnectGateOutput(theGate, myGate->getFirstConnectedOutput());
-	}
-	
-	// Remove the gate from the circuit:
-	gateList.erase(theGate);
-	if(polledGates.find( theGate) != polledGates.end() ) polledGates.erase( theGate );
-}
-
-
-// Delete a wire, removing its connections from gates first:
-//(The implementation of this may require that wires keep track
-// of their input gates.)
-void Circuit::deleteWire(IDType theWire) {
-	if(wireList.find( theWire) == wireList.end() ) {
-		WARNING("Circuit::deleteWire() - Invalid wire ID.");
-		return;
-	}
-	WIRE_PTR myWire = wireList[theWire];
-	
-	// Delete the wire's inputs:
-	WireInput tempI = myWire->getFirstInput();
-	while(tempI.gateID != ID_NONE) {
-		disconnectGateOutput(tempI.gateID, tempI.gateOutputID);
-		tempI = myWire->getFirstInput();
-	}
-
-	// Remove the wire from all connected junctions:
-	//(This will put all of the connected wires into the update list to have their
-	// state updated during the next step.)
-	ID_SET< IDType > wireJuncs = myWire->getJunctions();
-	ID_SET< IDType >::iterator theJunc = wireJuncs.begin();
-	while(theJunc != wireJuncs.end()) {
-		disconnectJunction(*theJunc, theWire);
-		theJunc++;
-	}
-
-	// Delete the wire's outputs:
-	WireOutput tempO = myWire->getFirstOutput();
-	while(tempO.gateID != ID_NONE) {
-		disconnectGateInput(tempO.gateID, tempO.gateInputID);
-		tempO = myWire->getFirstOutput();
-	}
-
-	// Remove the wire from the update list, since disconnectGateOutput()
-	// and disconnectJunction() will add it, and we don't want it
-	// updating after it's gone!
-	wireUpdateList.erase(theWire);
-
-	// Remove the wire from the circuit:
-	wireList.erase(theWire);
-}
-
-
-// Delete a junction, removing all its connections from wires first:
-void Circuit::deleteJunction(IDType theJunc) {
-	if(juncList.find( theJunc) == juncList.end() ) {
-		WARNING("Circuit::deleteJunction() - Invalid junction ID.");
-		return;
-	}
-	JUNC_PTR myJunc = juncList[theJunc];
-	
-	// Unhook all of the junction's connections:
-	//(This will put all of the connected wires into the update list to have their
-	// state updated during the next step.)
-	ID_SET< IDType > juncWires = myJunc->getWires();
-	ID_SET< IDType >::iterator theWire = juncWires.begin();
-	while(theWire != juncWires.end()) {
-		disconnectJunction(theJunc, *theWire);
-		theWire++;
-	}
-
-	// Take the junction out of the event list, to avoid calling events on it
-	// after it has been removed.
-	// Empty the priority queue into a temporary stack, filtering out outdated events:
-	stack< Event > tempEventStack;
-	while(!eventQueue.empty()) {
-		Event tempEvent = eventQueue.top();
-		if(!((tempEvent.isJunctionEvent) &&(tempEvent.junctionID == theJunc))) {
-			tempEventStack.push(tempEvent);
-		}
-		eventQueue.pop();
-	}
-		
-	// Push the stack back into the event queue:
-	while(!tempEventStack.empty()) {
-		eventQueue.push(tempEventStack.top());
-		tempEventStack.pop();
-	}
-
-	// Remove the junction from the circuit:
-	juncList.erase(theJunc);
-}
-
-/*OBSOLETE
-// Connect an external event output to this wire, and return a new wire input ID
-// which the output can connect to:
-IDType extCount = 0;
-IDType Circuit::connectExternalWireInput(IDType theWire) {
-	if(wireList.find( theWire) != wireList.end() ) {
-		extCount++; // Get a unique ID for the external input.
-		(wireList[theWire])->connectInput(ID_NONE, extCount);
-		return extCount;
-	} else {
-		WARNING("Circuit::connectExternalWireInput() - Invalid wire ID.");
-		return ID_NONE;
-	}
-}
-*/
-
-// Connect a gate input to the output of a wire:
-IDType Circuit::connectGateInput(IDType gateID, string gateInputID, IDType wireID) {
-	IDType returnWireID = 0;
-	
-	// First of all, create the wire if it doesn't already exist:
-	if(wireList.find(wireID) == wireList.end()) {
-		returnWireID = newWire(wireID);
-	}
-
-	// Hook the gate input to the wireID:
-	(gateList[gateID])->connectInput(gateInputID, wireID);
-	
-	// Hook the wire output to the gateID:
-	(wireList[wireID])->connectOutput(gateID, gateInputID);
-	
-	//TODO: Should trigger some kind of event since the wire now is connected to this here gate,
-	// and therefore the gate's input has changed!
-			// Gate needs to update its state and pass along events if outputs changed.
-			// We basically just need to force it into the update list.
-	gateUpdateList.insert(gateID);
-	
-	return returnWireID;
-}
-
-	
-// Connect a gate output to the input of a wire:
-//(The wire will create one unique input for each unique gateID/gateOutputID combination.)
-IDType Circuit::connectGateOutput(IDType gateID, string gateOutputID, IDType wireID) {
-	IDType returnWireID = 0;
-	
-	// First of all, create the wire if it doesn't already exist:
-	if(wireList.find(wireID) == wireList.end()) {
-		returnWireID = newWire(wireID);
-	}
-
-	// Connect the wire input to the gate:
-	(wireList[wireID])->connectInput(gateID, gateOutputID);
-
-	// Connect the gate output to the wire:
-	(gateList[gateID])->connectOutput(gateOutputID, wireID);
-	
-	
-	//TODO: Should trigger some kind of event since the gate is now providing a new input
-	// to this wire, and the wire's state has changed!
-			// Should be: wireinput.state == gate.lastoutput, unless an event is already
-			// scheduled for this gate output.
-			// Could do weird things if we connect a wire between the time a gate issued
-			// an event and the time that it is processed. ,'o)
-			// We need to force the gate to update and re-issue the last event for just this wire.
-			// But it needs to be an event so that the wire will update its output gates, too.
-		// My decision:
-			// I'm going to have the gate output keep track of its last event, and when the
-			// wire is connected, we will simply tell the gate to resend its last event to
-			// the newly connected wire.
-	(gateList[gateID])->resendLastEvent(gateID, gateOutputID, this);
-	
-	return returnWireID;
-}
-
-	
-// Disconnect a gate input from the output of a wire:
-void Circuit::disconnectGateInput(IDType gateID, string gateInputID) {
-	if(gateList.find( gateID) == gateList.end() ) {
-		WARNING("Circuit::disconnectGateInput() - Invalid gate ID.");
-		return;
-	}
-	GATE_PTR myGate = gateList[ gateID ];
-
-	// Disconnect the gate from the wire:
-	IDType theWire = myGate->disconnectInput(gateInputID);
-	
-	// Disconnect the wire from the gate:
-	if(wireList.find( theWire) != wireList.end() ) {
-		WIRE_PTR myWire = wireList[ theWire ];
-		myWire->disconnectOutput(gateID, gateInputID);
-	} else if(theWire != ID_NONE) {
-		WARNING("Circuit::disconnectGateInput() - Wire not found.");
-	}
-
-	//TODO: Trigger event to update gate.
-			// Gate needs to update its state and pass along events if outputs changed.
-			// We basically just need to force it into the update list.
-	gateUpdateList.insert(gateID);
-}
-
-	
-// Disconnect a gate output from the input of a wire:
-void Circuit::disconnectGateOutput(IDType gateID, string gateOutputID) {
-	if(gateList.find( gateID) == gateList.end() ) {
-		WARNING("Circuit::disconnectGateOutput() - Invalid gate ID.");
-		return;
-	}
-	GATE_PTR myGate = gateList[ gateID ];
-
-	// Wire needs to update based on its other inputs and
-	// cause its output gates to update as well. Just force it onto the update list.
-	// ADDITION: All wires connected by junctions also need to be updated, and
-	// the list needs to be made *before* the wire is disconnected.
-	IDType theWire = myGate->getOutputWire(gateOutputID);
-	ID_SET< IDType > juncWires = getJunctionGroupIDs(theWire);
-	wireUpdateList.insert(juncWires.begin(), juncWires.end());
-
-	// Disconnect the gate from the wire:
-	myGate->disconnectOutput(gateOutputID);
-	
-	// Disconnect the wire from the gate:
-	if(wireList.find( theWire) != wireList.end() ) {
-		WIRE_PTR myWire = wireList[ theWire ];
-		myWire->disconnectInput(gateID, gateOutputID);
-	} else if(theWire != ID_NONE) {
-		WARNING("Circuit::disconnectGateOutput() - Wire not found.");
-		return;
-	}
-
-	// You also have to clear the event queue of any events scheduled for this
-	// gate/gateOutput combination.
-	
-	// Empty the priority queue into a temporary stack, filtering out outdated events:
-	stack< Event > tempEventStack;
-	while(!eventQueue.empty()) {
-		Event tempEvent = eventQueue.top();
-		if(!((!tempEvent.isJunctionEvent) &&(tempEvent.gateID == gateID) && (tempEvent.gateOutputID == gateOutputID))) {
-			tempEventStack.push(tempEvent);
-		}
-		eventQueue.pop();
-	}
-		
-	// Push the stack back into the event queue:
-	while(!tempEventStack.empty()) {
-		eventQueue.push(tempEventStack.top());
-		tempEventStack.pop();
-	}
-
-	return;
-}
-
-
-// Connect a junction to a wire:
-void Circuit::connectJunction(IDType juncID, IDType wireID) {
-//TODO: Warn the user when a junction cannot happen!
-	if(juncList.find( juncID) == juncList.end() ) return;
-	if(wireList.find( wireID) == wireList.end() ) return;
-
-
-	// Get the junction and wire:
-	JUNC_PTR myJunc = juncList[juncID];
-	WIRE_PTR myWire = wireList[wireID];
-	
-	// Link the wire to the junction.
-	myJunc->connectWire(wireID);
-
-	// Connect the wire to the junction:
-	myWire->addJunction(juncID);
-
-	// Put all the wires of the junction group into the update list to have its
-	// state updated during the next step.
-	//(Note: Do this before after hooking up the wire!)
-	ID_SET< IDType > juncWires = getJunctionGroupIDs(wireID);
-	wireUpdateList.insert(juncWires.begin(), juncWires.end());
-}
-
-// Unhook a junction from a wire:
-void Circuit::disconnectJunction(IDType juncID, IDType wireID) {
-//TODO: Warn the user when a junction cannot happen!
-	if(juncList.find( juncID) == juncList.end() ) return;
-	if(wireList.find( wireID) == wireList.end() ) return;
-
-	// Put all the wires of the junction group into the update list to have its
-	// state updated during the next step.
-	//(Note: Do this before unhooking the wire!)
-	ID_SET< IDType > juncWires = getJunctionGroupIDs(wireID);
-	wireUpdateList.insert(juncWires.begin(), juncWires.end());
-
-	// Get the junction and wire:
-	JUNC_PTR myJunc = juncList[juncID];
-	WIRE_PTR myWire = wireList[wireID];
-	
-	// Unlink the wire from the junction.
-	if(myJunc->disconnectWire( wireID) ) {
-		// If the junction has no more of this wire
-		// connected to it, then unhook the wire from the junction:
-		myWire->removeJunction(juncID);
-	}
-}
-
-
-
-// Create an event and put it in the event queue:
-void Circuit::createEvent(TimeType eventTime, IDType wireID, IDType gateID, string gateOutputID, StateType newState) {
-	Event myEvent;
-	myEvent.eventTime = eventTime;
-	myEvent.wireID = wireID;
-	myEvent.gateID = gateID;
-	myEvent.gateOutputID = gateOutputID;
-	myEvent.newState = newState;
-
-	ostringstream oss;
-	oss << "Creating event for gate " << gateID << " output " << gateOutputID << " to state " <<(int) newState << " at time = " << eventTime << "." << endl;
-	WARNING(oss.str());
-
-#ifdef INERTIAL_DELAY
-	// Erase any other events in the queue with this gate output:
-	// Clear the event queue of any events scheduled for this gate/gateOutput combination:
-	
-	// Empty the priority queue into a temporary stack, filtering out outdated events:
-	stack< Event > tempEventStack;
-	while(!eventQueue.empty()) {
-		Event tempEvent = eventQueue.top();
-		if(!((!tempEvent.isJunctionEvent) &&(tempEvent.gateID == gateID) && (tempEvent.gateOutputID == gateOutputID))) {
-			tempEventStack.push(tempEvent);
-		}
-		eventQueue.pop();
-	}
-		
-	// Push the stack back into the event queue:
-	while(!tempEventStack.empty()) {
-		eventQueue.push(tempEventStack.top());
-		tempEventStack.pop();
-	}
-#endif
-
-	// Push the event onto the event queue:
-	eventQueue.push(myEvent);
-}
-
-
-// Create an event that occurs at systemTime + delay:
-TimeType Circuit::createDelayedEvent(TimeType delay, IDType wireID, IDType gateID, string gateOutputID, StateType newState) {
-	if((wireID != ID_NONE) && (gateOutputID != "")) {
-		createEvent(delay + getSystemTime(), wireID, gateID, gateOutputID, newState);
-	}
-	return delay + getSystemTime();
-}
-
-
-// Create Junction Event and put it in the event queue:
-void Circuit::createJunctionEvent(TimeType eventTime, IDType juncID, bool newState) {
-	Event myEvent;
-	myEvent.eventTime = eventTime;
-	myEvent.isJunctionEvent = true;
-	myEvent.newJunctionState = newState;
-	myEvent.junctionID = juncID;
-
-#ifdef INERTIAL_DELAY
-	// Erase any other events in the queue with this gate output:
-	// Clear the event queue of any events scheduled for this gate/gateOutput combination:
-	
-	// Empty the priority queue into a temporary stack, filtering out outdated events:
-	stack< Event > tempEventStack;
-	while(!eventQueue.empty()) {
-		Event tempEvent = eventQueue.top();
-		if(!((tempEvent.isJunctionEvent) &&(tempEvent.junctionID == juncID))) {
-			tempEventStack.push(tempEvent);
-		}
-		eventQueue.pop();
-	}
-		
-	// Push the stack back into the event queue:
-	while(!tempEventStack.empty()) {
-		eventQueue.push(tempEventStack.top());
-		tempEventStack.pop();
-	}
-#endif
-
-
-	// Push the event onto the event queue:
-	eventQueue.push(myEvent);
-}
-
-
-// Clear out the event queue, destroying all events,
-// and also erase all events in the gateUpdateList and wireUpdateList.
-// This is used if we wanted a simulation where all of the wires
-// start with "UNKNOWN" state and don't update until a signal
-// from the outside world reaches them.
-void Circuit::destroyAllEvents(void) {
-
-	while(!eventQueue.empty()) {
-		eventQueue.pop();
-	}
-
-	gateUpdateList.clear();
-	wireUpdateList.clear();
-}
-
-
-// Set a gate parameter:
-//(If the gate's parameter change requires the gate to be
-// re-evaluated during the next cycle, then add it to the 
-void Circuit::setGateParameter(IDType gateID, string paramName, string value) {
-	if(gateList.find( gateID) != gateList.end() ) {
-		if(gateList[gateID]->setParameter( paramName, value) ) {
-			// If the gate has changed parameters and needs updated, then
-			// add it to the gateUpdateList:
-			gateUpdateList.insert(gateID);
-		}
-	} else {
-		WARNING("Circuit::setGateParameter() - Gate not found.");
-	}
-	return;
-}
-
-void Circuit::setGateInputParameter(IDType gateID, string inputID, string paramName, string value) {
-	if(gateList.find( gateID) != gateList.end() ) {
-		if(gateList[gateID]->setInputParameter( inputID, paramName, value) ) {
-			// If the gate has changed parameters and needs updated, then
-			// add it to the gateUpdateList:
-			gateUpdateList.insert(gateID);
-		}
-	} else {
-		WARNING("Circuit::setGateParameter() - Gate not found.");
-	}
-	return;
-}
-
-void Circuit::setGateOutputParameter(IDType gateID, string outputID, string paramName, string value) {
-	if(gateList.find( gateID) != gateList.end() ) {
-		if(gateList[gateID]->setOutputParameter( outputID, paramName, value) ) {
-			// If the gate has changed parameters and needs updated, then
-			// add it to the gateUpdateList:
-			gateUpdateList.insert(gateID);
-		}
-	} else {
-		WARNING("Circuit::setGateParameter() - Gate not found.");
-	}
-	return;
-}
-
-
-// ************ Circuit inspection methods **************
-
-// Get the value of a gate parameter:
-string Circuit::getGateParameter(IDType gateID, string paramName) {
-
-	if(gateList.find( gateID) != gateList.end() ) {
-		return gateList[ gateID ]->getParameter(paramName);
-	} else {
-		WARNING("Circuit::setGateParameter() - Gate not found.");
-	}
-	return "";
-}
-
-
-// Get a wire state by ID:
-StateType Circuit::getWireState(IDType wireID) {
-	if(wireList.find( wireID) != wireList.end() ) {
-		return wireList[wireID]->getState();
-	} else {
-		WARNING("Circuit::getWireState() - Wire does not exist.");
-		return UNKNOWN;
-	}
-}
-
-// Get and set a junction's on/off toggle state:
-void Circuit::setJunctionState(IDType juncID, bool newState) {
-//TODO: Warn the user when a junction doesn't exist!
-	if(juncList.find( juncID) == juncList.end() ) return;
-
-	// Get the junction:
-	JUNC_PTR myJunc = juncList[juncID];
-	myJunc->setEnableState(newState);
-
-	// Put all of the connected wires into the "wireUpdateList" list to have their
-	// state updated during the next(or current) step() call.
-	//NOTE: MUST add ALL wires in ALL junction nodes that are attached to this junction!
-	ID_SET< IDType > juncWires = myJunc->getWires();
-	ID_SET< IDType >::iterator juncWire = juncWires.begin();
-	while(juncWire != juncWires.end()) {
-		ID_SET< IDType > juncGroup = getJunctionGroupIDs(*juncWire);
-		wireUpdateList.insert(juncGroup.begin(), juncGroup.end());
-		juncWire++;
-	}
-}
-
-bool Circuit::getJunctionState(IDType juncID) {
-//TODO: Warn the user when a junction doesn't exist!
-	if(juncList.find( juncID) == juncList.end() ) return false;
-
-	// Get the junction:
-	JUNC_PTR myJunc = juncList[juncID];
-	return myJunc->getEnableState();
-}
-
-
-// Return the current simulation time:
-TimeType Circuit::getSystemTime(void) {
-	return systemTime;
-}
-
-
-// Returns a list of IDs of wires that are connected to this
-// wire via junctions:
-set< IDType > Circuit::getJunctionGroupIDs(IDType wireID) {
-	// This is the wire group IDs that will be returned:
-	set< IDType > wireGroupIDs;
-
-//TODO: Warn the user when a wire does not exist!
-	if(wireList.find( wireID) == wireList.end() ) return wireGroupIDs;
-
-	// This wire is automatically included in the group:
-	WIRE_PTR thisWire = wireList[wireID];
-	wireGroupIDs.insert(wireID);
-
-	// This is the set of wires left to be searched:
-	set< IDType > searchList = wireGroupIDs;
-	
-
-	// Do a breadth-first search to add other wires into the list:
-
-	// Loop through any wires that are left to be checked:
-	while(!searchList.empty()) {
-
-		// Pop the first item off of the searching list:
-		IDType thisWireID = *(searchList.begin());
-		searchList.erase(thisWireID);
-
-		// Loop through all the junctions in this wire.
-		thisWire = wireList[thisWireID];
-		set< IDType > wireJuncs = thisWire->getJunctions();
-		set< IDType >::iterator thisJunc = wireJuncs.begin();
-		while(thisJunc != wireJuncs.end()) {
-	
-			// If the junction is marked as "enabled", then
-			// add all of its wires into the group:
-			if(getJunctionState( *thisJunc) ) {
-				set< IDType > juncWires = juncList[*thisJunc]->getWires();
-				
-				// Add all of the new wires into the "yet to check" list:
-				set_difference(juncWires.begin(), juncWires.end(),
-								wireGroupIDs.begin(), wireGroupIDs.end(),
-								inserter(searchList, searchList.begin()) );
-	
-				// Add the new wires to the "found attached" list:			
-				wireGroupIDs.insert(juncWires.begin(), juncWires.end());
-			}
-	
-			thisJunc++;
-		}
-
-	} // while(!searchList.empty())
-	
-	return wireGroupIDs;
-}
-
-
-// Returns a list of all wires that are connected to this
-// wire via junctions:
-set< WIRE_PTR > Circuit::getJunctionGroup(IDType wireID) {
-	// This is the wire group that will be returned:
-	set< WIRE_PTR > wireGroup;
-
-	// Get the IDs of connected wires:
-	set< IDType > wireGroupIDs = getJunctionGroupIDs(wireID);
-
-	// Convert all of the wire IDs into wire pointers:
-	set< IDType >::iterator wireIDs = wireGroupIDs.begin();
-	while(wireIDs != wireGroupIDs.end()) {
-		IDType theWireID = *wireIDs;
-		WIRE_PTR theWirePtr = wireList[ theWireID ];
-		wireGroup.insert(theWirePtr);
-		wireIDs++;
-	}
-
-	return wireGroup;
-}
-
-
-// Convert the wire IDs to wire pointers:
-set< WIRE_PTR > Circuit::getJunctionGroup(set< IDType >* wireGroupIDs) {
-	// This is the wire group that will be returned:
-	set< WIRE_PTR > wireGroup;
-
-	// Convert all of the wire IDs into wire pointers:
-	set< IDType >::iterator wireIDs = wireGroupIDs->begin();
-	while(wireIDs != wireGroupIDs->end()) {
-		IDType theWireID = *wireIDs;
-		WIRE_PTR theWirePtr = wireList[ theWireID ];
-		wireGroup.insert(theWirePtr);
-		wireIDs++;
-	}
-
-	return wireGroup;
-}
-
-
-
-
-
-
-// ************* End of the visible interface of the circuit ****************
-
-
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.   
+*****************************************************************************/
+
+// logic_circuit.cpp: implementation of the Circuit class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include "logic_circuit.h"
+#include "logic_partition.h"
+#include <iostream>
+#include <algorithm>
+
+#include "../Z80/Z_80LogicGate.h"
+
+#ifndef _PRODUCTION_
+ofstream* logiclog;
+#endif
+
+
+// If this is defined, circuits start out using inertial delay, otherwise
+// they default to transport delay(see Circuit::setDelayMode()):
+//#define INERTIAL_DELAY
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+Circuit::Circuit()
+{
+	// Set time to begin starting:
+	systemTime = 0;
+	
+	// Set the initial ID values:
+	gateIDCount = 0;
+	wireIDCount = 0;
+	juncIDCount = 0;
+	busIDCount = 0;
+
+	// Start numbering the events:
+	eventSequence = 0;
+	eventCount = 0;
+
+	// The stats are off until they are asked for:
+	statsEnabled = false;
+	phaseTiming = false;
+	statsPhaseStart = 0.0;
+	profiling = false;
+
+	// Nothing has been stamped by a step yet:
+	stepCount = 0;
+
+	// The compiled connectivity is built by the first step:
+	connectivityChanged = true;
+
+	// Start out with the event engine:
+	engine = ENGINE_EVENT;
+	levelizedActive = false;
+	scheduleChanged = true;
+	scheduleValid = false;
+	levelizedFullUpdate = false;
+	deferOutputs = false;
+
+	// Run sequentially until asked to partition the circuit:
+	partitionEngine = NULL;
+	partitionCount = 1;
+	partitionChanged = true;
+	lastRunPartitioned = false;
+
+	// Nothing is logged until asked for:
+	changeLog = NULL;
+
+#ifdef INERTIAL_DELAY
+	delayMode = DELAY_INERTIAL;
+#else
+	delayMode = DELAY_TRANSPORT;
+#endif
+	
+#ifndef _PRODUCTION_
+	logiclog = new ofstream("corelog.log");
+#endif
+}
+
+Circuit::~Circuit()
+{
+	// Cause all of the gates to destroy themselves
+	// before the Circuit gets destroyed, or any other
+	// objects are removed:
+	//(This is needed so that if their destructors call
+	// any Circuit methods, they won't crash.)
+
+	delete partitionEngine;
+	gateList.clear();
+}
+
+// **************** The visible interface of the circuit ********************
+
+// ********** Circuit input methods *************
+
+//***************************************
+//Edit by Joshua Lansford 3/27/07
+//purpose of edit: The ram gate needs to
+//update its pop-up right after it loads
+//even if it is paused.  Thus this method
+//is created, so that the pop-ups
+//can request that the core proces
+//thegateUpdateList without advanceing
+//the system time
+void Circuit::stepOnlyGates(){
+	// The levelized engine updates the gates at its next step:
+	updateEngine();
+	if(levelizedActive) return;
+
+	// Update the gates that have been connected or disconnected or had a 
+	// parameter change within the last call to step() so that they can
+	// recalculate correctly:
+	ID_SET< IDType >::iterator updateGate = gateUpdateList.begin();
+	while(updateGate != gateUpdateList.end()) {
+		Gate* myGate = gateList.get(*updateGate);
+		myGate->updateGate(*updateGate, this);
+		scheduleWakeUp(myGate, systemTime);
+		updateGate++;
+	}
+	gateUpdateList.clear();
+}
+//End of Edit*****************************
+
+
+// Step the simulation forward by one timestep:
+// If a pointer to a set is passed, then it will
+// return a set of all the changed wires to the calling function.
+void Circuit::step(ID_SET< IDType > *changedWires)
+{
+	LOGIC_TRACE_SCOPE("step");
+
+	// Catch up on any changes to the circuit's connections, and hand the
+	// step to the levelized engine if it is running the circuit:
+	updateEngine();
+	if(levelizedActive) {
+		stepLevelized(changedWires);
+		return;
+	}
+#ifdef LOGIC_STATS
+	phaseTiming = statsEnabled || traceIsOn();
+#endif
+	LOGIC_STAT(stepStats.clear())
+	LOGIC_PHASE(statsPhaseStart = statsTime())
+
+	// Update the gates that have been connected or disconnected or had a 
+	// parameter change within the last call to step() so that they can
+	// recalculate correctly:
+	//(The self-scheduling gates, like CLOCK, aren't polled here. They are
+	// woken up by their own events in the queue below.)
+	ID_SET< IDType >::iterator updateGate = gateUpdateList.begin();
+	while(updateGate != gateUpdateList.end()) {
+		Gate* myGate = gateList.get(*updateGate);
+		LOGIC_STAT(countGateStat(myGate))
+		myGate->updateGate(*updateGate, this);
+		scheduleWakeUp(myGate, systemTime + 1);
+		updateGate++;
+	}
+	gateUpdateList.clear();
+	LOGIC_PHASE(endStatsPhase(STATS_PHASE_GATE_UPDATES))
+
+	// Start a new set of stamps for the work lists:
+	stepCount++;
+	dirtyWires.clear();
+
+	// Loop through all of the events with time == now, and 
+	// activate them.
+	LOGIC_STAT(stepStats.queueHighWater = eventQueue.size())
+	while(!eventQueue.empty() && (eventQueue.top().eventTime <= systemTime)) {
+		// Pop the event off of the event queue:
+		Event myEvent = eventQueue.top();
+		eventQueue.pop();
+		LOGIC_STAT(stepStats.eventsPopped++)
+
+		// Throw it away if it has been cancelled:
+		if(isCancelled(myEvent)) {
+			LOGIC_STAT(stepStats.eventsCancelled++)
+			freeBusEventValue(myEvent);
+			continue;
+		}
+		
+		EventSource &mySource = eventSources[myEvent.source];
+		if(myEvent.eventType == EVENT_WAKE_UP) {
+			// Update a self-scheduling gate that asked to be woken up now,
+			// and find out when it wants to be woken up next:
+			//(Any events it creates for now are handled in this loop.)
+			Gate* myGate = gateList.get(mySource.gateID);
+			LOGIC_STAT(countGateStat(myGate))
+			myGate->updateGate(mySource.gateID, this);
+			scheduleWakeUp(myGate, systemTime + 1);
+		} else {
+			// Otherwise, make the wire or junction event happen:
+			applyEvent(myEvent);
+		}
+		
+		eventCount++;
+	}
+	LOGIC_PHASE(endStatsPhase(STATS_PHASE_EVENTS))
+	
+	// Mark the wires that have been disconnected(or were part of a junction that changed) within
+	// the last call to step() as dirty too, so that they will be properly updated:
+	//(The list may name a wire more than once, or name a wire that has
+	// since been deleted.)
+	for(unsigned long i = 0; i < wireUpdateList.size(); i++) {
+		Wire* myWire = wireList.get(wireUpdateList[i]);
+		if((myWire != NULL) && (myWire->stepMark != stepCount)) {
+			myWire->stepMark = stepCount;
+			dirtyWires.push_back(wireUpdateList[i]);
+		}
+	}
+	wireUpdateList.clear();	// Empty the wireUpdateList, since we are handling the updates.
+	
+
+	// Calculate the new wire states, and make a list of affected gates:
+	//(Only the wires whose state really changed wake up their gates
+	// and are passed back in changedWires.)
+	changedWireList.clear();
+	changedGates.clear();
+	for(unsigned long i = 0; i < dirtyWires.size(); i++) {
+		Wire* myWire = wireList.get(dirtyWires[i]);
+		
+		// Calculate the new state of a wire:
+		//(Note: The whole junction group gets the state worked out from the
+		// group's tally of drivers, once.)
+		JunctionGroup &wireGroup = junctionGroups[myWire->junctionGroup];
+		if(wireGroup.stepMark == stepCount) continue;
+		wireGroup.stepMark = stepCount;
+		LOGIC_STAT(stepStats.groupsWalked++; stepStats.wiresResolved += wireGroup.wires.size())
+
+		StateType juncState = wireGroup.drivers.resolve();
+		for(unsigned long j = 0; j < wireGroup.wires.size(); j++) {
+			Wire* groupWire = wireList.get(wireGroup.wires[j]);
+			if(groupWire->getState() == juncState) continue;
+
+			groupWire->forceState(juncState);
+			changedWireList.push_back(wireGroup.wires[j]);
+
+			// Add this wire's gates to the overall gate list:
+			unsigned long fanoutEnd = fanoutStart[groupWire->compiledIndex + 1];
+			for(unsigned long k = fanoutStart[groupWire->compiledIndex]; k < fanoutEnd; k++) {
+				Gate* myGate = compiledGates[fanoutGates[k]];
+				if(myGate->stepMark != stepCount) {
+					myGate->stepMark = stepCount;
+					changedGates.push_back(fanoutGates[k]);
+				}
+			}
+		}
+	}
+	
+	// Update all of the gates and retrieve the events from them:
+	//(In order of gate ID, as always, so that the gates' events and
+	// parameter changes come out in the same order from run to run. The
+	// compiled indexes are in the same order as the IDs.)
+	sort(changedGates.begin(), changedGates.end());
+	LOGIC_PHASE(endStatsPhase(STATS_PHASE_WIRES))
+	LOGIC_STAT(for(unsigned long i = 0; i < changedGates.size(); i++) countGateStat(compiledGates[changedGates[i]]))
+	if((threadPool.getThreadCount() > 1) && (changedGates.size() >= PARALLEL_GATE_THRESHOLD)) {
+		updateGatesInParallel();
+	} else {
+		for(unsigned long i = 0; i < changedGates.size(); i++) {
+			Gate* myGate = compiledGates[changedGates[i]];
+			
+			myGate->updateGate(compiledGateIDs[changedGates[i]], this);
+			scheduleWakeUp(myGate, systemTime + 1);
+		}
+	}
+	LOGIC_PHASE(endStatsPhase(STATS_PHASE_GATES))
+	if(changeLog != NULL) logChangedWires();
+
+	// Increment the system timer, because this timestep is complete:
+	systemTime++;
+	LOGIC_STAT(stepStats.steps = 1; totalStats.add(stepStats))
+	
+	// Pass back the changed wires if they were asked for:
+	if(changedWires != NULL)
+		changedWires->insert(changedWireList.begin(), changedWireList.end());
+} // step()
+
+
+// Log the wires in changedWireList at the end of a step:
+void Circuit::logChangedWires(void) {
+	for(unsigned long i = 0; i < changedWireList.size(); i++) {
+		changeLog->push_back(LoggedChange(systemTime, changedWireList[i], "", wireList.get(changedWireList[i])->getState()));
+	}
+}
+
+
+// Compare two change logs, leaving out the order of the changes within each
+// timestep:
+unsigned long compareChangeLogs(vector< LoggedChange > firstLog, vector< LoggedChange > secondLog, ostream &out, unsigned long maxReports) {
+	sort(firstLog.begin(), firstLog.end());
+	sort(secondLog.begin(), secondLog.end());
+
+	// Walk through the two logs together, and report the changes that are
+	// only in one of them:
+	unsigned long differences = 0;
+	unsigned long i = 0, j = 0;
+	while(i < firstLog.size() || j < secondLog.size()) {
+		bool inFirst;
+		if(j >= secondLog.size()) inFirst = true;
+		else if(i >= firstLog.size()) inFirst = false;
+		else if(firstLog[i] == secondLog[j]) {
+			i++;
+			j++;
+			continue;
+		} else inFirst = (firstLog[i] < secondLog[j]);
+
+		const LoggedChange &theChange = inFirst ? firstLog[i++] : secondLog[j++];
+		if(differences++ >= maxReports) continue;
+		out << "time " << theChange.changeTime << ": ";
+		if(theChange.paramName == "") out << "wire " << theChange.id << " went to " << (int) theChange.newState;
+		else out << "gate " << theChange.id << " changed " << theChange.paramName;
+		out << " in the " << (inFirst ? "first" : "second") << " run only" << endl;
+	}
+	return differences;
+}
+
+
+// Update the gates in changedGates across the thread pool, and then make
+// their events and parameter changes in the order of changedGates:
+void Circuit::updateGatesInParallel(void) {
+	heldCalls.resize(threadPool.getThreadCount());
+	for(unsigned long i = 0; i < heldCalls.size(); i++) heldCalls[i].clear();
+	heldGateCalls.resize(changedGates.size());
+
+	// Update the gates. Each thread only touches its own gates and its own
+	// list of held calls, and the wire states are only read:
+	GateUpdateTask updateTask(this);
+	threadPool.run(&updateTask, changedGates.size());
+
+	// Make the held calls, gate by gate, just as the gates would have made
+	// them if they had been updated one at a time:
+	for(unsigned long i = 0; i < changedGates.size(); i++) {
+		Gate* myGate = compiledGates[changedGates[i]];
+		IDType gateID = compiledGateIDs[changedGates[i]];
+		HeldGateCalls &gateCalls = heldGateCalls[i];
+
+		if(gateCalls.thread == ID_NONE) {
+			myGate->updateGate(gateID, this);
+		} else {
+			vector< GateCall > &threadCalls = heldCalls[gateCalls.thread];
+			for(unsigned long j = gateCalls.first; j < gateCalls.last; j++) {
+				GateCall &theCall = threadCalls[j];
+				switch(theCall.callType) {
+				case GATE_CALL_EVENT:
+					createEvent(theCall.eventTime, gateID, theCall.outputPin, theCall.newState);
+					break;
+				case GATE_CALL_BUS_EVENT:
+					createBusEvent(theCall.eventTime, gateID, theCall.outputPin, theCall.busState, theCall.changedLines);
+					break;
+				case GATE_CALL_PARAM:
+					addUpdateParam(gateID, theCall.paramName);
+					break;
+				}
+			}
+		}
+		scheduleWakeUp(myGate, systemTime + 1);
+	}
+}
+
+
+// Update a range of changedGates on one of the pool's threads, holding their
+// calls to the Circuit in the thread's list:
+void Circuit::updateGateRange(unsigned long threadIndex, unsigned long first, unsigned long last) {
+	vector< GateCall > &threadCalls = heldCalls[threadIndex];
+	for(unsigned long i = first; i < last; i++) {
+		Gate* myGate = compiledGates[changedGates[i]];
+		HeldGateCalls &gateCalls = heldGateCalls[i];
+
+		if(!myGate->canUpdateInParallel()) {
+			gateCalls.thread = ID_NONE;
+			continue;
+		}
+
+		gateCalls.thread = threadIndex;
+		gateCalls.first = threadCalls.size();
+		myGate->heldCalls = &threadCalls;
+		myGate->updateGate(compiledGateIDs[changedGates[i]], this);
+		myGate->heldCalls = NULL;
+		gateCalls.last = threadCalls.size();
+	}
+}
+
+
+// Make a wire or junction event happen:
+void Circuit::applyEvent(const Event &theEvent) {
+	EventSource &mySource = eventSources[theEvent.source];
+	if(theEvent.eventType == EVENT_JUNCTION) {
+		// Handle the junction event:
+		setJunctionState(mySource.junctionID, (theEvent.newState == ONE));
+
+		// Also adds all of the wires hooked up to this junction to
+		// the "wireUpdateList" list.
+		//(Handled inside of a setJunctionState() method, to allow
+		// it to be called from outside of an event handle - for zero delay.)
+	} else if(theEvent.eventType == EVENT_BUS) {
+		// Make the event happen to each of the bus lines that it changes:
+		BusEventValue busValue = busEventValues[theEvent.busValue];
+		freeBusEventValue(theEvent);
+
+		Gate* myGate = gateList.get(mySource.gateID);
+		const vector< PinType > &busPins = myGate->outputBuses[mySource.outputBus].pins;
+		for(unsigned long i = 0; i < busPins.size(); i++) {
+			if(!busBit(busValue.changedLines, i)) continue;
+
+			EventSource &lineSource = eventSources[myGate->getOutputSource(busPins[i])];
+			setWireInput(lineSource.wireID, mySource.gateID, busPins[i], busValue.newState.getLine(i));
+		}
+	} else if(theEvent.eventType == EVENT_WIRE) {
+		// Else, make the event happen to the wire:
+		setWireInput(mySource.wireID, mySource.gateID, mySource.gateOutputPin, theEvent.newState);
+	}
+}
+
+
+// Run the simulation until systemTime reaches endTime, stepping only
+// through the timesteps where something can happen:
+void Circuit::runUntil(TimeType endTime, ID_SET< IDType > *changedWires) {
+	lastRunPartitioned = false;
+	bool tryPartitioned = (partitionCount > 1);
+	while(systemTime < endTime) {
+		// Once the pending gate and wire updates have been stepped through,
+		// hand the rest of the run to the partitioned engine if it can take it:
+		if(tryPartitioned && gateUpdateList.empty() && wireUpdateList.empty()) {
+			tryPartitioned = false;
+			if(runPartitioned(endTime, changedWires)) {
+				lastRunPartitioned = true;
+				break;
+			}
+		}
+
+		skipIdleTime(endTime);
+		if(systemTime >= endTime) break;
+
+		step();
+		if(changedWires != NULL) changedWires->insert(changedWireList.begin(), changedWireList.end());
+	}
+}
+
+
+// Run the simulation forward by dt timesteps:
+void Circuit::advance(TimeType dt, ID_SET< IDType > *changedWires) {
+	runUntil(systemTime + dt, changedWires);
+}
+
+
+// Set the number of partitions that runUntil() and advance() cut the
+// circuit into:
+void Circuit::setPartitionCount(unsigned long newCount) {
+	if(newCount < 1) newCount = 1;
+	if(newCount == partitionCount) return;
+	partitionCount = newCount;
+	partitionChanged = true;
+}
+
+
+// Run until endTime with the partitioned engine, if it can:
+bool Circuit::runPartitioned(TimeType endTime, ID_SET< IDType > *changedWires) {
+	// The partitions are cut from the compiled connectivity:
+	updateEngine();
+	if(levelizedActive) return false;
+
+	if(partitionEngine == NULL) partitionEngine = new PartitionEngine(this);
+	if(partitionChanged) {
+		partitionEngine->compile(partitionCount);
+		partitionChanged = false;
+	}
+	return partitionEngine->run(endTime, changedWires);
+}
+
+
+// Jump systemTime forward over the idle timesteps, but never past endTime:
+TimeType Circuit::skipIdleTime(TimeType endTime) {
+	TimeType nextTime = getNextActiveTime();
+	if(nextTime > endTime) nextTime = endTime;
+	if(nextTime <= systemTime) return 0;
+
+	TimeType skipped = nextTime - systemTime;
+	systemTime = nextTime;
+	return skipped;
+}
+
+
+// Return the earliest time at or after systemTime at which step() has
+// something to do, or TIME_NONE if the circuit is completely idle:
+TimeType Circuit::getNextActiveTime(void) {
+	// Pending gate and wire updates are handled at the next step:
+	if(!gateUpdateList.empty() || !wireUpdateList.empty()) {
+		return systemTime;
+	}
+
+	// The levelized engine only has something to do at the clock edges:
+	if(engine == ENGINE_LEVELIZED) {
+		if(connectivityChanged || scheduleChanged || levelizedFullUpdate) return systemTime;
+		if(levelizedActive) {
+			TimeType nextTime = TIME_NONE;
+			for(unsigned long i = 0; i < scheduleClocks.size(); i++) {
+				nextTime = min(nextTime, compiledGates[scheduleClocks[i]]->getWakeUpTime(systemTime));
+			}
+			return nextTime;
+		}
+	}
+
+	TimeType nextTime = TIME_NONE;
+	discardCancelledEvents();
+	if(!eventQueue.empty()) {
+		//(Events in the past are handled at the next step too.)
+		nextTime = max(eventQueue.top().eventTime, systemTime);
+	}
+
+	//(The self-scheduling gates' wake-ups are in the queue too, so a
+	// free-running clock doesn't stop the skipping between its edges.)
+	return nextTime;
+}
+
+
+// Create a new gate, and return its ID:
+IDType Circuit::newGate(string type, IDType gateID) {
+	IDType thisGateID;
+
+	if(gateID == ID_NONE) {
+		// If no ID is specified for the new gate, then generate one:
+		thisGateID = gateIDCount;
+		gateIDCount++;
+	} else {
+		// Otherwise use the one given and make sure that the ID is not
+		// ever re-used for a generated ID:
+		thisGateID = gateID;
+		gateIDCount = max(gateID + 1, gateIDCount);
+	}
+
+	// If the gate isn't already created, then make it:
+	if(!gateList.exists(thisGateID)) {
+		connectivityChanged = true;
+
+		// Create a gate of the proper type:
+		if(type == "AND") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_AND));
+		} else if(type == "OR") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_OR));
+		} else if(type == "XOR") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_XOR));
+		} else if(type == "BUFFER") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_PASS));
+		} else if(type == "MUX") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_MUX));
+		} else if(type == "DECODER") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_DECODER));
+		} else if(type == "CLOCK") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_CLOCK));
+			// The clock wakes itself up at each of its edges:
+			setUpWakeUps(thisGateID);
+		} else if(type == "PULSE") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_PULSE));
+			// The pulse wakes itself up while it is running:
+			setUpWakeUps(thisGateID);
+		} else if(type == "DRIVER") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_DRIVER));
+		} else if(type == "ADDER") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_ADDER));
+		} else if(type == "COMPARE") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_COMPARE));
+		} else if(type == "JKFF") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_JKFF));
+		} else if(type == "RAM") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_RAM));
+		} else if(type == "REGISTER") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_REGISTER));
+		} else if((type == "FROM") || ( type == "TO" ) ) {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_JUNCTION( this) ));
+		} else if(type == "TGATE") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_T( this) ));
+		} else if(type == "NODE") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_NODE( this) ));
+		} else if(type == "EQUIVALENCE") {
+			gateList.insert(thisGateID, GATE_PTR(new Gate_EQUIVALENCE));
+//*******************************************************************
+//  Edit by Joshua Lansford 1/22/06
+//  This edit is added because Nathan Harro and I are adding a new
+//  gate type!!
+		} else if(type == "Z80"){
+			gateList.insert(thisGateID, GATE_PTR(new Z_80LogicGate()));
+// End of edit*******************************************************
+
+//********************************
+//  Edit by Joshua Lansford 4/10/07
+//  now adding the ADC
+		} else if(type == "ADC"){
+			gateList.insert(thisGateID, GATE_PTR(new Gate_ADC()));
+// End of edit********************
+
+//********************************
+//  Edit by Joshua Lansford 6/05/07
+//  now adding the pauseulator
+		} else if(type == "Pauseulator"){
+			gateList.insert(thisGateID, GATE_PTR(new Gate_pauseulator()));
+// End of edit*******************
+
+		} else {
+			WARNING("Circuit::newGate() - Invalid logic type!");
+		}
+
+		// Number the gate's type for the stats:
+		if(gateList.exists(thisGateID)) {
+			unsigned long typeIndex = 0;
+			while((typeIndex < gateTypeNames.size()) && (gateTypeNames[typeIndex] != type)) typeIndex++;
+			if(typeIndex == gateTypeNames.size()) {
+				gateTypeNames.push_back(type);
+				stepStats.gatesByType.resize(gateTypeNames.size(), 0);
+				totalStats.gatesByType.resize(gateTypeNames.size(), 0);
+			}
+			gateList.get(thisGateID)->typeIndex = typeIndex;
+		}
+
+	} else {
+		WARNING("Circuit::newGate() - Re-used gate ID!");
+	}
+	
+	// Always initialize the non-polled gates, so that it drives some value:
+//NOTE: Crashed the small computer file for some reason.
+//	if(scheduledGates.find( thisGateID) == scheduledGates.end() ) {
+//		gateUpdateList.insert(gateID);
+//	}
+	
+	return thisGateID;
+}
+
+	
+// Create a new wire and return its ID:
+IDType Circuit::newWire(IDType wireID) {
+	IDType thisWireID;
+	WIRE_PTR myWire(new Wire);
+	
+	if(wireID == ID_NONE) {
+		// If no ID is specified for the new wire, then generate one:
+		thisWireID = wireIDCount;
+		wireIDCount++;
+	} else {
+		// Otherwise use the one given and make sure that the ID is not
+		// ever re-used for a generated ID:
+		thisWireID = wireID;
+		wireIDCount = max(wireID + 1, wireIDCount);
+	}
+	
+	// If the wire isn't already created, then make it:
+	if(!wireList.exists(thisWireID)) {
+		wireList.insert(thisWireID, myWire);
+		connectivityChanged = true;
+
+		// Every wire starts out in a junction group of its own:
+		myWire->junctionGroup = newJunctionGroup();
+		junctionGroups[myWire->junctionGroup].wires.push_back(thisWireID);
+	} else {
+		WARNING("Circuit::newWire() - Re-used wire ID!");
+	}
+	
+	return thisWireID;
+}
+
+
+// Create a new junction and return its ID:
+IDType Circuit::newJunction(IDType juncID ) {
+	IDType thisJuncID;
+	
+	if(juncID == ID_NONE) {
+		// If no ID is specified for the new junction, then generate one:
+		thisJuncID = juncIDCount;
+		juncIDCount++;
+	} else {
+		// Otherwise use the one given and make sure that the ID is not
+		// ever re-used for a generated ID:
+		thisJuncID = juncID;
+		juncIDCount = max(juncID + 1, juncIDCount);
+	}
+
+	JUNC_PTR myJunc(new Junction(thisJuncID));
+
+	// If the junction isn't already created, then make it:
+	if(!juncList.exists(thisJuncID)) {
+		juncList.insert(thisJuncID, myJunc);
+
+		// Give the junction an event source for its events to refer to:
+		SourceType source = newEventSource();
+		eventSources[source].junctionID = thisJuncID;
+		myJunc->setEventSource(source);
+	} else {
+		WARNING("Circuit::newJunction() - Re-used junction ID!");
+	}
+	
+	return thisJuncID;
+}
+
+
+
+// Delete a gate, removing its connections to wires first:
+void Circuit::deleteGate(IDType theGate) {
+	if(!gateList.exists(theGate)) {
+		WARNING("Circuit::deleteGate() - Invalid gate ID.");
+		return;
+	}
+	Gate* myGate = gateList.get(theGate);
+	
+	// Delete the gate's inputs:
+	while(myGate->getFirstConnectedInput() != "") {
+		disconnectGateInput(theGate, myGate->getFirstConnectedInput());
+	}
+
+	// Remove the gate from the update list, since disconnectGateInput()
+	// will add it, and we don't want it updating after it's gone!
+	gateUpdateList.erase(theGate);
+
+	// Delete the gate's outputs:
+	while(myGate->getFirstConnectedOutput() != "") {
+		disconnectGateOutput(theGate, myGate->getFirstConnectedOutput());
+	}
+	
+	// Stop its wake-ups, if it is self-scheduling:
+	if(myGate->getWakeUpSource() != SOURCE_NONE) {
+		freeEventSource(myGate->getWakeUpSource());
+		scheduledGates.erase(theGate);
+	}
+
+	// Remove the gate from the circuit:
+	gateList.erase(theGate);
+	connectivityChanged = true;
+}
+
+
+// Delete a wire, removing its connections from gates first:
+//(The implementation of this may require that wires keep track
+// of their input gates.)
+void Circuit::deleteWire(IDType theWire) {
+	if(!wireList.exists(theWire)) {
+		WARNING("Circuit::deleteWire() - Invalid wire ID.");
+		return;
+	}
+	Wire* myWire = wireList.get(theWire);
+	
+	// Delete the wire's inputs:
+	WireInput tempI = myWire->getFirstInput();
+	while(tempI.gateID != ID_NONE) {
+		disconnectGateOutput(tempI.gateID, gateList.get(tempI.gateID)->getOutputName(tempI.gateOutputPin));
+		tempI = myWire->getFirstInput();
+	}
+
+	// Remove the wire from all connected junctions:
+	//(This will put all of the connected wires into the update list to have their
+	// state updated during the next step.)
+	ID_SET< IDType > wireJuncs = myWire->getJunctions();
+	ID_SET< IDType >::iterator theJunc = wireJuncs.begin();
+	while(theJunc != wireJuncs.end()) {
+		disconnectJunction(*theJunc, theWire);
+		theJunc++;
+	}
+
+	// Delete the wire's outputs:
+	WireOutput tempO = myWire->getFirstOutput();
+	while(tempO.gateID != ID_NONE) {
+		disconnectGateInput(tempO.gateID, gateList.get(tempO.gateID)->getInputName(tempO.gateInputPin));
+		tempO = myWire->getFirstOutput();
+	}
+
+	//(disconnectGateOutput() and disconnectJunction() will have put the
+	// wire on the update list, but step() skips the wires that are gone.)
+
+	// Free the wire's junction group, which is just the wire itself now
+	// that it is off all of its junctions:
+	junctionGroups[myWire->junctionGroup].wires.clear();
+	junctionGroups[myWire->junctionGroup].drivers.clear();
+	freeJunctionGroups.push_back(myWire->junctionGroup);
+
+	// Remove the wire from the circuit:
+	wireList.erase(theWire);
+	connectivityChanged = true;
+}
+
+
+// Delete a junction, removing all its connections from wires first:
+void Circuit::deleteJunction(IDType theJunc) {
+	if(!juncList.exists(theJunc)) {
+		WARNING("Circuit::deleteJunction() - Invalid junction ID.");
+		return;
+	}
+	Junction* myJunc = juncList.get(theJunc);
+	
+	// Unhook all of the junction's connections:
+	//(This will put all of the connected wires into the update list to have their
+	// state updated during the next step.)
+	ID_SET< IDType > juncWires = myJunc->getWires();
+	ID_SET< IDType >::iterator theWire = juncWires.begin();
+	while(theWire != juncWires.end()) {
+		disconnectJunction(theJunc, *theWire);
+		theWire++;
+	}
+
+	// Take the junction out of the event list, to avoid calling events on it
+	// after it has been removed.
+	//(Freeing its event source cancels the events.)
+	freeEventSource(myJunc->getEventSource());
+
+	// Remove the junction from the circuit:
+	juncList.erase(theJunc);
+}
+
+/*OBSOLETE
+// Connect an external event output to this wire, and return a new wire input ID
+// which the output can connect to:
+IDType extCount = 0;
+IDType Circuit::connectExternalWireInput(IDType theWire) {
+	if(wireList.exists(theWire)) {
+		extCount++; // Get a unique ID for the external input.
+		wireList.get(theWire)->connectInput(ID_NONE, extCount);
+		return extCount;
+	} else {
+		WARNING("Circuit::connectExternalWireInput() - Invalid wire ID.");
+		return ID_NONE;
+	}
+}
+*/
+
+// Connect a gate input to the output of a wire:
+IDType Circuit::connectGateInput(IDType gateID, string gateInputID, IDType wireID) {
+	IDType returnWireID = 0;
+	
+	// First of all, create the wire if it doesn't already exist:
+	if(!wireList.exists(wireID)) {
+		returnWireID = newWire(wireID);
+	}
+
+	// Hook the gate input to the wireID:
+	gateList.get(gateID)->connectInput(gateInputID, wireID);
+	
+	// Hook the wire output to the gateID:
+	//(The gate has declared the input by now, if it didn't exist.)
+	wireList.get(wireID)->connectOutput(gateID, gateList.get(gateID)->findInput(gateInputID));
+	connectivityChanged = true;
+	
+	//TODO: Should trigger some kind of event since the wire now is connected to this here gate,
+	// and therefore the gate's input has changed!
+			// Gate needs to update its state and pass along events if outputs changed.
+			// We basically just need to force it into the update list.
+	gateUpdateList.insert(gateID);
+	
+	return returnWireID;
+}
+
+	
+// Connect a gate output to the input of a wire:
+//(The wire will create one unique input for each unique gateID/gateOutputID combination.)
+IDType Circuit::connectGateOutput(IDType gateID, string gateOutputID, IDType wireID) {
+	IDType returnWireID = 0;
+	
+	// First of all, create the wire if it doesn't already exist:
+	if(!wireList.exists(wireID)) {
+		returnWireID = newWire(wireID);
+	}
+
+	// Connect the gate output to the wire:
+	Gate* myGate = gateList.get(gateID);
+	myGate->connectOutput(gateOutputID, wireID);
+	PinType gateOutputPin = myGate->findOutput(gateOutputID);
+
+	// Give the gate output an event source for its events to refer to:
+	SourceType source = myGate->getOutputSource(gateOutputPin);
+	if(source == SOURCE_NONE) {
+		source = newEventSource();
+		myGate->setOutputSource(gateOutputPin, source);
+	}
+	eventSources[source].gateID = gateID;
+	eventSources[source].gateOutputPin = gateOutputPin;
+	eventSources[source].wireID = wireID;
+	scheduleChanged = true;
+	partitionChanged = true;
+
+	// Connect the wire input to the gate:
+	Wire* myWire = wireList.get(wireID);
+	myWire->connectInput(gateID, gateOutputPin);
+	countJunctionGroupDrivers(myWire->junctionGroup);
+	
+	
+	//TODO: Should trigger some kind of event since the gate is now providing a new input
+	// to this wire, and the wire's state has changed!
+			// Should be: wireinput.state == gate.lastoutput, unless an event is already
+			// scheduled for this gate output.
+			// Could do weird things if we connect a wire between the time a gate issued
+			// an event and the time that it is processed. ,'o)
+			// We need to force the gate to update and re-issue the last event for just this wire.
+			// But it needs to be an event so that the wire will update its output gates, too.
+		// My decision:
+			// I'm going to have the gate output keep track of its last event, and when the
+			// wire is connected, we will simply tell the gate to resend its last event to
+			// the newly connected wire.
+	myGate->resendLastEvent(gateID, gateOutputPin, this);
+	
+	return returnWireID;
+}
+
+	
+// Disconnect a gate input from the output of a wire:
+void Circuit::disconnectGateInput(IDType gateID, string gateInputID) {
+	if(!gateList.exists(gateID)) {
+		WARNING("Circuit::disconnectGateInput() - Invalid gate ID.");
+		return;
+	}
+	Gate* myGate = gateList.get(gateID);
+	PinType gateInputPin = myGate->findInput(gateInputID);
+
+	// Disconnect the gate from the wire:
+	IDType theWire = myGate->disconnectInput(gateInputID);
+	connectivityChanged = true;
+	
+	// Disconnect the wire from the gate:
+	if(wireList.exists(theWire)) {
+		Wire* myWire = wireList.get(theWire);
+		myWire->disconnectOutput(gateID, gateInputPin);
+	} else if(theWire != ID_NONE) {
+		WARNING("Circuit::disconnectGateInput() - Wire not found.");
+	}
+
+	//TODO: Trigger event to update gate.
+			// Gate needs to update its state and pass along events if outputs changed.
+			// We basically just need to force it into the update list.
+	gateUpdateList.insert(gateID);
+}
+
+	
+// Disconnect a gate output from the input of a wire:
+void Circuit::disconnectGateOutput(IDType gateID, string gateOutputID) {
+	if(!gateList.exists(gateID)) {
+		WARNING("Circuit::disconnectGateOutput() - Invalid gate ID.");
+		return;
+	}
+	Gate* myGate = gateList.get(gateID);
+	PinType gateOutputPin = myGate->findOutput(gateOutputID);
+
+	// If the output is a line of an output bus, break the bus up first:
+	if((gateOutputPin != PIN_NONE) && (myGate->outputList[gateOutputPin].outputBus != ID_NONE)) {
+		disconnectOutputBus(myGate, myGate->outputList[gateOutputPin].outputBus);
+	}
+
+	// Wire needs to update based on its other inputs and
+	// cause its output gates to update as well. Just force it onto the update list.
+	// ADDITION: All wires connected by junctions also need to be updated, and
+	// the list needs to be made *before* the wire is disconnected.
+	IDType theWire = myGate->getOutputWire(gateOutputID);
+	ID_SET< IDType > juncWires = getJunctionGroupIDs(theWire);
+	wireUpdateList.insert(wireUpdateList.end(), juncWires.begin(), juncWires.end());
+
+	// Disconnect the gate from the wire:
+	myGate->disconnectOutput(gateOutputID);
+	scheduleChanged = true;
+	partitionChanged = true;
+
+	// You also have to clear the event queue of any events scheduled for this
+	// gate/gateOutput combination.
+	//(Freeing its event source cancels the events.)
+	SourceType source = myGate->getOutputSource(gateOutputPin);
+	if(source != SOURCE_NONE) {
+		freeEventSource(source);
+		myGate->setOutputSource(gateOutputPin, SOURCE_NONE);
+	}
+	
+	// Disconnect the wire from the gate:
+	if(wireList.exists(theWire)) {
+		Wire* myWire = wireList.get(theWire);
+		myWire->disconnectInput(gateID, gateOutputPin);
+		countJunctionGroupDrivers(myWire->junctionGroup);
+	} else if(theWire != ID_NONE) {
+		WARNING("Circuit::disconnectGateOutput() - Wire not found.");
+		return;
+	}
+
+	return;
+}
+
+
+// Create a new bus wire with numLines lines and return its ID:
+IDType Circuit::newBusWire(unsigned long numLines, IDType busID) {
+	IDType thisBusID;
+	if(busID == ID_NONE) {
+		thisBusID = busIDCount;
+		busIDCount++;
+	} else {
+		thisBusID = busID;
+		busIDCount = max(busID + 1, busIDCount);
+	}
+
+	if(busList.find(thisBusID) != busList.end()) {
+		WARNING("Circuit::newBusWire() - Re-used bus ID!");
+		return thisBusID;
+	}
+
+	// Each line is an ordinary wire:
+	vector< IDType > &busLines = busList[thisBusID];
+	for(unsigned long i = 0; i < numLines; i++) {
+		busLines.push_back(newWire());
+	}
+
+	return thisBusID;
+}
+
+
+// Delete a bus wire, along with all of its lines:
+void Circuit::deleteBusWire(IDType busID) {
+	if(busList.find(busID) == busList.end()) {
+		WARNING("Circuit::deleteBusWire() - Invalid bus ID.");
+		return;
+	}
+
+	vector< IDType > busLines = busList[busID];
+	busList.erase(busID);
+	for(unsigned long i = 0; i < busLines.size(); i++) {
+		if(wireList.exists(busLines[i])) deleteWire(busLines[i]);
+	}
+}
+
+
+// Return the wire IDs of a bus wire's lines:
+vector< IDType > Circuit::getBusLines(IDType busID) {
+	ID_MAP< IDType, vector< IDType > >::iterator thisBus = busList.find(busID);
+	if(thisBus == busList.end()) {
+		WARNING("Circuit::getBusLines() - Invalid bus ID.");
+		return vector< IDType >();
+	}
+	return thisBus->second;
+}
+
+
+// Connect the inputs "busName_0" through "busName_x" of a gate to the lines
+// of a bus wire:
+void Circuit::connectGateInputBus(IDType gateID, string busName, IDType busID) {
+	if(!gateList.exists(gateID) || (busList.find(busID) == busList.end())) {
+		WARNING("Circuit::connectGateInputBus() - Invalid gate or bus ID.");
+		return;
+	}
+
+	vector< IDType > &busLines = busList[busID];
+	for(unsigned long i = 0; i < busLines.size(); i++) {
+		ostringstream oss;
+		oss << busName << "_" << i;
+		connectGateInput(gateID, oss.str(), busLines[i]);
+	}
+}
+
+
+// Connect the outputs "busName_0" through "busName_x" of a gate to the lines
+// of a bus wire, as a single output bus:
+void Circuit::connectGateOutputBus(IDType gateID, string busName, IDType busID) {
+	if(!gateList.exists(gateID) || (busList.find(busID) == busList.end())) {
+		WARNING("Circuit::connectGateOutputBus() - Invalid gate or bus ID.");
+		return;
+	}
+	Gate* myGate = gateList.get(gateID);
+
+	// Connect the lines one at a time first:
+	//(This breaks up any output bus that the outputs were in before.)
+	vector< IDType > busLines = busList[busID];
+	vector< PinType > busPins;
+	for(unsigned long i = 0; i < busLines.size(); i++) {
+		ostringstream oss;
+		oss << busName << "_" << i;
+		PinType gateOutputPin = myGate->findOutput(oss.str());
+		if(gateOutputPin == PIN_NONE) {
+			WARNING("Circuit::connectGateOutputBus() - Bus is wider than the gate's outputs.");
+			return;
+		}
+		if(myGate->outputList[gateOutputPin].outputBus != ID_NONE) {
+			disconnectOutputBus(myGate, myGate->outputList[gateOutputPin].outputBus);
+		}
+		connectGateOutput(gateID, oss.str(), busLines[i]);
+		busPins.push_back(gateOutputPin);
+	}
+
+	// Buses wider than the bit planes just stay separate lines:
+	if(busPins.empty() || (busPins.size() > BUS_PLANE_BITS)) return;
+
+	// Find a place in the gate's list of output buses:
+	unsigned long busIndex = 0;
+	while((busIndex < myGate->outputBuses.size()) && !myGate->outputBuses[busIndex].pins.empty()) busIndex++;
+	if(busIndex == myGate->outputBuses.size()) myGate->outputBuses.push_back(GateOutputBus());
+
+	GateOutputBus &myBus = myGate->outputBuses[busIndex];
+	myBus.pins = busPins;
+	myBus.eventSource = newEventSource();
+	eventSources[myBus.eventSource].gateID = gateID;
+	eventSources[myBus.eventSource].outputBus = busIndex;
+	for(unsigned long i = 0; i < busPins.size(); i++) {
+		myGate->outputList[busPins[i]].outputBus = busIndex;
+	}
+}
+
+
+// Connect a junction to a wire:
+void Circuit::connectJunction(IDType juncID, IDType wireID) {
+//TODO: Warn the user when a junction cannot happen!
+	if(!juncList.exists(juncID)) return;
+	if(!wireList.exists(wireID)) return;
+
+
+	// Get the junction and wire:
+	Junction* myJunc = juncList.get(juncID);
+	Wire* myWire = wireList.get(wireID);
+	
+	// Link the wire to the junction.
+	myJunc->connectWire(wireID);
+
+	// Connect the wire to the junction:
+	myWire->addJunction(juncID);
+
+	// If the junction is enabled, then the wire is now tied to the
+	// junction's other wires:
+	if(myJunc->getEnableState()) {
+		mergeJunctionGroups(wireID, myJunc->getOtherWire(wireID));
+	}
+
+	// Put all the wires of the junction group into the update list to have its
+	// state updated during the next step.
+	//(Note: Do this before after hooking up the wire!)
+	ID_SET< IDType > juncWires = getJunctionGroupIDs(wireID);
+	wireUpdateList.insert(wireUpdateList.end(), juncWires.begin(), juncWires.end());
+}
+
+// Unhook a junction from a wire:
+void Circuit::disconnectJunction(IDType juncID, IDType wireID) {
+//TODO: Warn the user when a junction cannot happen!
+	if(!juncList.exists(juncID)) return;
+	if(!wireList.exists(wireID)) return;
+
+	// Put all the wires of the junction group into the update list to have its
+	// state updated during the next step.
+	//(Note: Do this before unhooking the wire!)
+	ID_SET< IDType > juncWires = getJunctionGroupIDs(wireID);
+	wireUpdateList.insert(wireUpdateList.end(), juncWires.begin(), juncWires.end());
+
+	// Get the junction and wire:
+	Junction* myJunc = juncList.get(juncID);
+	Wire* myWire = wireList.get(wireID);
+	
+	// Unlink the wire from the junction.
+	if(myJunc->disconnectWire( wireID) ) {
+		// If the junction has no more of this wire
+		// connected to it, then unhook the wire from the junction:
+		myWire->removeJunction(juncID);
+
+		// The wire may have been holding its junction group together:
+		if(myJunc->getEnableState()) {
+			splitJunctionGroup(myWire->junctionGroup);
+		}
+	}
+}
+
+
+
+// Create an event and put it in the event queue:
+//(The event goes to the wire that the gate output is connected to.)
+void Circuit::createEvent(TimeType eventTime, IDType gateID, PinType gateOutputPin, StateType newState) {
+	Gate* myGate = gateList.get(gateID);
+	SourceType source = (myGate != NULL) ? myGate->getOutputSource(gateOutputPin) : SOURCE_NONE;
+	if(source == SOURCE_NONE) {
+		WARNING("Circuit::createEvent() - Gate output is not connected.");
+		return;
+	}
+
+	// The levelized engine sets the wire straight away, or once all of the
+	// state elements have been updated:
+	if(levelizedActive) {
+		if(deferOutputs) {
+			deferredOutputs.push_back(ScheduledOutput(eventSources[source].wireID, gateID, gateOutputPin, newState));
+		} else {
+			setWireInputNow(eventSources[source].wireID, gateID, gateOutputPin, newState);
+		}
+		return;
+	}
+
+	// With inertial delay, cancel any event still pending for this
+	// gate/gateOutput combination, so it only ever has one:
+	DelayModeType gateDelayMode = myGate->getDelayMode();
+	if(gateDelayMode == DELAY_DEFAULT) gateDelayMode = delayMode;
+	if(gateDelayMode == DELAY_INERTIAL) {
+		cancelEvents(source);
+	}
+
+	Event myEvent;
+	myEvent.eventTime = eventTime;
+	myEvent.sequence = eventSequence++;
+	myEvent.source = source;
+	myEvent.eventType = EVENT_WIRE;
+	myEvent.newState = newState;
+	myEvent.busValue = 0;
+
+	// Push the event onto the event queue:
+	eventQueue.push(myEvent);
+}
+
+
+// Create an event that occurs at systemTime + delay:
+TimeType Circuit::createDelayedEvent(TimeType delay, IDType wireID, IDType gateID, PinType gateOutputPin, StateType newState) {
+	if((wireID != ID_NONE) && (gateOutputPin != PIN_NONE)) {
+		createEvent(delay + getSystemTime(), gateID, gateOutputPin, newState);
+	}
+	return delay + getSystemTime();
+}
+
+
+// Create Junction Event and put it in the event queue:
+void Circuit::createJunctionEvent(TimeType eventTime, IDType juncID, bool newState) {
+//TODO: Warn the user when a junction doesn't exist!
+	Junction* myJunc = juncList.get(juncID);
+	if(myJunc == NULL) return;
+
+	// With inertial delay, cancel any event still pending for this junction:
+	if(delayMode == DELAY_INERTIAL) {
+		cancelEvents(myJunc->getEventSource());
+	}
+
+	Event myEvent;
+	myEvent.eventTime = eventTime;
+	myEvent.sequence = eventSequence++;
+	myEvent.source = myJunc->getEventSource();
+	myEvent.eventType = EVENT_JUNCTION;
+	myEvent.newState = newState ? ONE : ZERO;
+	myEvent.busValue = 0;
+
+	// Push the event onto the event queue:
+	eventQueue.push(myEvent);
+}
+
+
+// Create a bus event for a gate's connected output bus, which changes the
+// lines in changedLines to their states in newState:
+void Circuit::createBusEvent(TimeType eventTime, IDType gateID, unsigned long busIndex, const BusPlanes &newState, unsigned long changedLines) {
+	Gate* myGate = gateList.get(gateID);
+	GateOutputBus &myBus = myGate->outputBuses[busIndex];
+
+	// With inertial delay, the bus acts as one output: cancel any event still
+	// pending for it or for any of its lines, and send all of the lines again:
+	DelayModeType gateDelayMode = myGate->getDelayMode();
+	if(gateDelayMode == DELAY_DEFAULT) gateDelayMode = delayMode;
+	if(gateDelayMode == DELAY_INERTIAL) {
+		cancelEvents(myBus.eventSource);
+		for(unsigned long i = 0; i < myBus.pins.size(); i++) {
+			cancelEvents(myGate->getOutputSource(myBus.pins[i]));
+		}
+		changedLines = busMask(myBus.pins.size());
+	}
+	if(changedLines == 0) return;
+
+	// Find a place to keep the line states:
+	unsigned short busValue;
+	if(!levelizedActive && !freeBusEventValues.empty()) {
+		busValue = freeBusEventValues.back();
+		freeBusEventValues.pop_back();
+	} else if(!levelizedActive && (busEventValues.size() <= USHRT_MAX)) {
+		busValue = busEventValues.size();
+		busEventValues.push_back(BusEventValue());
+	} else {
+		// The table is full(or the levelized engine is running, which has no
+		// use for bus events), so send the lines as separate wire events:
+		for(unsigned long i = 0; i < myBus.pins.size(); i++) {
+			if(!busBit(changedLines, i)) continue;
+			createEvent(eventTime, gateID, myBus.pins[i], newState.getLine(i));
+		}
+		return;
+	}
+	busEventValues[busValue].newState = newState;
+	busEventValues[busValue].changedLines = changedLines;
+
+	Event myEvent;
+	myEvent.eventTime = eventTime;
+	myEvent.sequence = eventSequence++;
+	myEvent.source = myBus.eventSource;
+	myEvent.eventType = EVENT_BUS;
+	myEvent.newState = UNKNOWN;
+	myEvent.busValue = busValue;
+
+	// Push the event onto the event queue:
+	eventQueue.push(myEvent);
+}
+
+
+// Clear out the event queue, destroying all events,
+// and also erase all events in the gateUpdateList and wireUpdateList.
+// This is used if we wanted a simulation where all of the wires
+// start with "UNKNOWN" state and don't update until a signal
+// from the outside world reaches them.
+void Circuit::destroyAllEvents(void) {
+
+	eventQueue.clear();
+	busEventValues.clear();
+	freeBusEventValues.clear();
+
+	gateUpdateList.clear();
+	wireUpdateList.clear();
+
+	// The self-scheduling gates lost their wake-ups with the rest of the
+	// queue, so give them new ones:
+	ID_SET< IDType >::iterator scheduledGate = scheduledGates.begin();
+	while(scheduledGate != scheduledGates.end()) {
+		scheduleWakeUp(gateList.get(*scheduledGate), systemTime);
+		scheduledGate++;
+	}
+}
+
+
+// Set a gate parameter:
+//(If the gate's parameter change requires the gate to be
+// re-evaluated during the next cycle, then add it to the 
+void Circuit::setGateParameter(IDType gateID, string paramName, string value) {
+	if(gateList.exists(gateID)) {
+		Gate* myGate = gateList.get(gateID);
+		if(myGate->setParameter( paramName, value) ) {
+			// If the gate has changed parameters and needs updated, then
+			// add it to the gateUpdateList:
+			gateUpdateList.insert(gateID);
+		}
+
+		// A self-scheduling gate may want waking up at a different time now
+		//(a CLOCK with a new HALF_CYCLE, or a PULSE that was just started):
+		scheduleWakeUp(myGate, systemTime);
+	} else {
+		WARNING("Circuit::setGateParameter() - Gate not found.");
+	}
+	return;
+}
+
+void Circuit::setGateInputParameter(IDType gateID, string inputID, string paramName, string value) {
+	if(gateList.exists(gateID)) {
+		if(gateList.get(gateID)->setInputParameter( inputID, paramName, value) ) {
+			// If the gate has changed parameters and needs updated, then
+			// add it to the gateUpdateList:
+			gateUpdateList.insert(gateID);
+		}
+	} else {
+		WARNING("Circuit::setGateParameter() - Gate not found.");
+	}
+	return;
+}
+
+void Circuit::setGateOutputParameter(IDType gateID, string outputID, string paramName, string value) {
+	if(gateList.exists(gateID)) {
+		// The output's enable pin may have changed:
+		scheduleChanged = true;
+		if(gateList.get(gateID)->setOutputParameter( outputID, paramName, value) ) {
+			// If the gate has changed parameters and needs updated, then
+			// add it to the gateUpdateList:
+			gateUpdateList.insert(gateID);
+		}
+	} else {
+		WARNING("Circuit::setGateParameter() - Gate not found.");
+	}
+	return;
+}
+
+
+// ************ Circuit inspection methods **************
+
+// Get the value of a gate parameter:
+string Circuit::getGateParameter(IDType gateID, string paramName) {
+
+	if(gateList.exists(gateID)) {
+		return gateList.get(gateID)->getParameter(paramName);
+	} else {
+		WARNING("Circuit::setGateParameter() - Gate not found.");
+	}
+	return "";
+}
+
+
+// Get a wire state by ID:
+StateType Circuit::getWireState(IDType wireID) {
+	Wire* myWire = wireList.get(wireID);
+	if(myWire != NULL) {
+		return myWire->getState();
+	} else {
+		WARNING("Circuit::getWireState() - Wire does not exist.");
+		return UNKNOWN;
+	}
+}
+
+// Get and set a junction's on/off toggle state:
+void Circuit::setJunctionState(IDType juncID, bool newState) {
+//TODO: Warn the user when a junction doesn't exist!
+	if(!juncList.exists(juncID)) return;
+
+	// Get the junction:
+	Junction* myJunc = juncList.get(juncID);
+	bool wasEnabled = myJunc->getEnableState();
+	myJunc->setEnableState(newState);
+
+	// Re-form the junction groups if the junction was switched:
+	const multiset< IDType > &juncWires = myJunc->getWireList();
+	if(!juncWires.empty() && (newState != wasEnabled)) {
+		IDType firstWire = *(juncWires.begin());
+		if(newState) {
+			// Tie all of the junction's wires together:
+			multiset< IDType >::const_iterator juncWire = juncWires.begin();
+			while(juncWire != juncWires.end()) {
+				mergeJunctionGroups(firstWire, *juncWire);
+				juncWire++;
+			}
+		} else {
+			// All of the junction's wires were in one group, which may
+			// now fall apart:
+			splitJunctionGroup(wireList.get(firstWire)->junctionGroup);
+		}
+	}
+
+	// Put all of the connected wires into the "wireUpdateList" list to have their
+	// state updated during the next(or current) step() call.
+	//NOTE: MUST update ALL wires in ALL junction groups that are attached to this junction!
+	//(The junction's own wires are enough for that, since step() works out
+	// the state of each one's whole junction group, and every group that the
+	// junction joined or split up has one of them.)
+	wireUpdateList.insert(wireUpdateList.end(), juncWires.begin(), juncWires.end());
+}
+
+bool Circuit::getJunctionState(IDType juncID) {
+//TODO: Warn the user when a junction doesn't exist!
+	if(!juncList.exists(juncID)) return false;
+
+	// Get the junction:
+	Junction* myJunc = juncList.get(juncID);
+	return myJunc->getEnableState();
+}
+
+
+// Return the current simulation time:
+TimeType Circuit::getSystemTime(void) {
+	return systemTime;
+}
+
+
+// Turn on or off the step() counters:
+void Circuit::setStatsEnabled(bool enable) {
+#ifdef LOGIC_STATS
+	statsEnabled = enable;
+#else
+	statsEnabled = false;
+#endif
+}
+
+// Zero the step() counters:
+void Circuit::clearStats(void) {
+	stepStats.clear();
+	totalStats.clear();
+}
+
+// Turn on or off the gate profiler:
+void Circuit::setProfiling(bool enable) {
+#ifdef LOGIC_STATS
+	profiling = enable;
+#else
+	profiling = false;
+#endif
+}
+
+// Zero the gate profile:
+void Circuit::clearProfile(void) {
+	ID_SET< IDType > gateIDs = gateList.getIDs();
+	ID_SET< IDType >::iterator gateWalk = gateIDs.begin();
+	while(gateWalk != gateIDs.end()) {
+		Gate* myGate = gateList.get(*gateWalk);
+		myGate->profileCalls = 0;
+		myGate->profileSeconds = 0.0;
+		gateWalk++;
+	}
+}
+
+static bool moreProfileTime(const GateProfileEntry &left, const GateProfileEntry &right) {
+	return(left.seconds > right.seconds);
+}
+
+// Return the gate profile by gate type:
+vector< GateProfileEntry > Circuit::getGateTypeProfile(void) {
+	vector< GateProfileEntry > byType(gateTypeNames.size());
+	for(unsigned long i = 0; i < gateTypeNames.size(); i++) byType[i].gateType = gateTypeNames[i];
+
+	ID_SET< IDType > gateIDs = gateList.getIDs();
+	ID_SET< IDType >::iterator gateWalk = gateIDs.begin();
+	while(gateWalk != gateIDs.end()) {
+		Gate* myGate = gateList.get(*gateWalk);
+		byType[myGate->typeIndex].calls += myGate->profileCalls;
+		byType[myGate->typeIndex].seconds += myGate->profileSeconds;
+		gateWalk++;
+	}
+
+	vector< GateProfileEntry > profile;
+	for(unsigned long i = 0; i < byType.size(); i++) {
+		if(byType[i].calls > 0) profile.push_back(byType[i]);
+	}
+	stable_sort(profile.begin(), profile.end(), moreProfileTime);
+	return profile;
+}
+
+// Return the gate profile by gate:
+vector< GateProfileEntry > Circuit::getGateProfile(void) {
+	vector< GateProfileEntry > profile;
+	ID_SET< IDType > gateIDs = gateList.getIDs();
+	ID_SET< IDType >::iterator gateWalk = gateIDs.begin();
+	while(gateWalk != gateIDs.end()) {
+		Gate* myGate = gateList.get(*gateWalk);
+		if(myGate->profileCalls > 0) {
+			GateProfileEntry entry;
+			entry.gateID = *gateWalk;
+			entry.gateType = gateTypeNames[myGate->typeIndex];
+			entry.calls = myGate->profileCalls;
+			entry.seconds = myGate->profileSeconds;
+			profile.push_back(entry);
+		}
+		gateWalk++;
+	}
+	stable_sort(profile.begin(), profile.end(), moreProfileTime);
+	return profile;
+}
+
+// Add up the gates' update counts:
+unsigned long long Circuit::getGateUpdateCount(void) {
+	unsigned long long updateCount = 0;
+	ID_SET< IDType > gateIDs = gateList.getIDs();
+	ID_SET< IDType >::iterator gateWalk = gateIDs.begin();
+	while(gateWalk != gateIDs.end()) {
+		updateCount += gateList.get(*gateWalk)->updateCount;
+		gateWalk++;
+	}
+	return updateCount;
+}
+
+
+// Returns a list of IDs of wires that are connected to this
+// wire via junctions:
+set< IDType > Circuit::getJunctionGroupIDs(IDType wireID) {
+	// This is the wire group IDs that will be returned:
+	set< IDType > wireGroupIDs;
+
+//TODO: Warn the user when a wire does not exist!
+	Wire* thisWire = wireList.get(wireID);
+	if(thisWire == NULL) return wireGroupIDs;
+
+	// The wire's junction group is kept up to date as the junctions
+	// change, so just copy it:
+	vector< IDType > &wireGroup = junctionGroups[thisWire->junctionGroup].wires;
+	wireGroupIDs.insert(wireGroup.begin(), wireGroup.end());
+	
+	return wireGroupIDs;
+}
+
+
+// Returns a list of all wires that are connected to this
+// wire via junctions:
+set< WIRE_PTR > Circuit::getJunctionGroup(IDType wireID) {
+	// This is the wire group that will be returned:
+	set< WIRE_PTR > wireGroup;
+
+//TODO: Warn the user when a wire does not exist!
+	Wire* thisWire = wireList.get(wireID);
+	if(thisWire == NULL) return wireGroup;
+
+	// Convert all of the wire IDs into wire pointers:
+	vector< IDType > &wireGroupIDs = junctionGroups[thisWire->junctionGroup].wires;
+	vector< IDType >::iterator wireIDs = wireGroupIDs.begin();
+	while(wireIDs != wireGroupIDs.end()) {
+		IDType theWireID = *wireIDs;
+		WIRE_PTR theWirePtr = wireList.getPtr(theWireID);
+		wireGroup.insert(theWirePtr);
+		wireIDs++;
+	}
+
+	return wireGroup;
+}
+
+
+// Convert the wire IDs to wire pointers:
+set< WIRE_PTR > Circuit::getJunctionGroup(set< IDType >* wireGroupIDs) {
+	// This is the wire group that will be returned:
+	set< WIRE_PTR > wireGroup;
+
+	// Convert all of the wire IDs into wire pointers:
+	set< IDType >::iterator wireIDs = wireGroupIDs->begin();
+	while(wireIDs != wireGroupIDs->end()) {
+		IDType theWireID = *wireIDs;
+		WIRE_PTR theWirePtr = wireList.getPtr(theWireID);
+		wireGroup.insert(theWirePtr);
+		wireIDs++;
+	}
+
+	return wireGroup;
+}
+
+
+
+
+
+
+// ************* End of the visible interface of the circuit ****************
+
+
+// Make a new, empty junction group and return its ID:
+IDType Circuit::newJunctionGroup(void) {
+	if(!freeJunctionGroups.empty()) {
+		IDType groupID = freeJunctionGroups.back();
+		freeJunctionGroups.pop_back();
+		return groupID;
+	}
+
+	junctionGroups.push_back(JunctionGroup());
+	return junctionGroups.size() - 1;
+}
+
+
+// Put two wires' junction groups together:
+//(The wires of the smaller group are moved into the larger one.)
+void Circuit::mergeJunctionGroups(IDType wireA, IDType wireB) {
+	if((wireA == ID_NONE) || (wireB == ID_NONE)) return;
+
+	IDType groupA = wireList.get(wireA)->junctionGroup;
+	IDType groupB = wireList.get(wireB)->junctionGroup;
+	scheduleChanged = true;
+	partitionChanged = true;
+	if(groupA == groupB) return;
+
+	if(junctionGroups[groupA].wires.size() < junctionGroups[groupB].wires.size()) {
+		swap(groupA, groupB);
+	}
+
+	JunctionGroup &bigGroup = junctionGroups[groupA];
+	JunctionGroup &smallGroup = junctionGroups[groupB];
+	for(unsigned long i = 0; i < smallGroup.wires.size(); i++) {
+		wireList.get(smallGroup.wires[i])->junctionGroup = groupA;
+		bigGroup.wires.push_back(smallGroup.wires[i]);
+	}
+	bigGroup.drivers.add(smallGroup.drivers);
+
+	smallGroup.wires.clear();
+	smallGroup.drivers.clear();
+	freeJunctionGroups.push_back(groupB);
+}
+
+
+// Break a junction group back up into the groups that are still
+// tied together after a junction was disabled or lost a wire:
+void Circuit::splitJunctionGroup(IDType groupID) {
+	// Take all of the wires out of the group:
+	vector< IDType > oldGroup;
+	oldGroup.swap(junctionGroups[groupID].wires);
+	scheduleChanged = true;
+	partitionChanged = true;
+	junctionGroups[groupID].drivers.clear();
+	freeJunctionGroups.push_back(groupID);
+
+	for(unsigned long i = 0; i < oldGroup.size(); i++) {
+		wireList.get(oldGroup[i])->junctionGroup = ID_NONE;
+	}
+
+	// Do a breadth-first search from each wire that hasn't been put back into
+	// a group yet. (Only the wires of the old group can be reached.)
+	for(unsigned long i = 0; i < oldGroup.size(); i++) {
+		if(wireList.get(oldGroup[i])->junctionGroup != ID_NONE) continue;
+
+		IDType newGroupID = newJunctionGroup();
+		vector< IDType > &newGroup = junctionGroups[newGroupID].wires;
+		wireList.get(oldGroup[i])->junctionGroup = newGroupID;
+		newGroup.push_back(oldGroup[i]);
+
+		// The group itself is the search list:
+		for(unsigned long j = 0; j < newGroup.size(); j++) {
+			set< IDType > wireJuncs = wireList.get(newGroup[j])->getJunctions();
+			set< IDType >::iterator thisJunc = wireJuncs.begin();
+			while(thisJunc != wireJuncs.end()) {
+				// If the junction is marked as "enabled", then
+				// add all of its wires into the group:
+				if(getJunctionState( *thisJunc) ) {
+					set< IDType > juncWires = juncList.get(*thisJunc)->getWires();
+					set< IDType >::iterator juncWire = juncWires.begin();
+					while(juncWire != juncWires.end()) {
+						Wire* theWire = wireList.get(*juncWire);
+						if(theWire->junctionGroup == ID_NONE) {
+							theWire->junctionGroup = newGroupID;
+							newGroup.push_back(*juncWire);
+						}
+						juncWire++;
+					}
+				}
+				thisJunc++;
+			}
+		}
+
+		countJunctionGroupDrivers(newGroupID);
+	}
+}
+
+
+// Make a new event source and return its index:
+SourceType Circuit::newEventSource(void) {
+	SourceType source;
+	if(!freeEventSources.empty()) {
+		source = freeEventSources.back();
+		freeEventSources.pop_back();
+	} else {
+		source = eventSources.size();
+		eventSources.push_back(EventSource());
+	}
+
+	// Any events still in the queue from the source's last use stay cancelled:
+	eventSources[source] = EventSource();
+	cancelEvents(source);
+	return source;
+}
+
+
+// Put an event source back on the free list:
+//(Any events left in the queue from it are cancelled.)
+void Circuit::freeEventSource(SourceType source) {
+	if(source == SOURCE_NONE) return;
+	eventSources[source] = EventSource();
+	cancelEvents(source);
+	freeEventSources.push_back(source);
+}
+
+
+// Throw away the cancelled events at the front of the event queue:
+void Circuit::discardCancelledEvents(void) {
+	while(!eventQueue.empty() && isCancelled(eventQueue.top())) {
+		freeBusEventValue(eventQueue.top());
+		eventQueue.pop();
+	}
+}
+
+
+// Change the state that a gate output is driving onto a wire, and mark the
+// wire as dirty for step():
+void Circuit::setWireInput(IDType wireID, IDType gateID, PinType gateOutputPin, StateType newState) {
+	Wire* myWire = wireList.get(wireID);
+	StateType oldState = myWire->setInputState(gateID, gateOutputPin, newState);
+
+	// Move the input in the junction group's tally of drivers too:
+	JunctionGroup &wireGroup = junctionGroups[myWire->junctionGroup];
+	wireGroup.drivers.remove(oldState);
+	wireGroup.drivers.add(newState);
+
+	// Mark the wire as dirty:
+	//(Its whole junction group is worked out with it in step().)
+	if(myWire->stepMark != stepCount) {
+		myWire->stepMark = stepCount;
+		dirtyWires.push_back(wireID);
+	}
+}
+
+
+// Break a gate's output bus back up into lines that send their own events:
+//(Bus events still in the queue for it are cancelled, so the lines are
+// given their last states again as wire events.)
+void Circuit::disconnectOutputBus(Gate* theGate, unsigned long busIndex) {
+	GateOutputBus &theBus = theGate->outputBuses[busIndex];
+	freeEventSource(theBus.eventSource);
+	theBus.eventSource = SOURCE_NONE;
+
+	vector< PinType > busPins = theBus.pins;
+	theBus.pins.clear();
+	for(unsigned long i = 0; i < busPins.size(); i++) {
+		GateOutput &theOutput = theGate->outputList[busPins[i]];
+		theOutput.outputBus = ID_NONE;
+		if((theOutput.eventSource != SOURCE_NONE) && (theOutput.lastEventTime != TIME_NONE)) {
+			createEvent(max(theOutput.lastEventTime, systemTime), eventSources[theOutput.eventSource].gateID, busPins[i], theOutput.lastEventState);
+		}
+	}
+}
+
+
+// Make a gate self-scheduling, and give it its first wake-up:
+void Circuit::setUpWakeUps(IDType gateID) {
+	Gate* myGate = gateList.get(gateID);
+	SourceType source = newEventSource();
+	eventSources[source].gateID = gateID;
+	myGate->setWakeUpSource(source);
+	scheduledGates.insert(gateID);
+
+	scheduleWakeUp(myGate, systemTime);
+}
+
+
+// Replace a self-scheduling gate's pending wake-up event with one for
+// the next time, at or after fromTime, that the gate asks for:
+void Circuit::scheduleWakeUp(Gate* theGate, TimeType fromTime) {
+	SourceType source = theGate->getWakeUpSource();
+	if(source == SOURCE_NONE) return;
+
+	// The levelized engine asks the CLOCK gates itself:
+	if(levelizedActive) return;
+
+	cancelEvents(source);
+	TimeType wakeTime = theGate->getWakeUpTime(fromTime);
+	if(wakeTime == TIME_NONE) return;
+
+	Event myEvent;
+	myEvent.eventTime = wakeTime;
+	myEvent.sequence = eventSequence++;
+	myEvent.source = source;
+	myEvent.eventType = EVENT_WAKE_UP;
+	myEvent.newState = UNKNOWN;
+	myEvent.busValue = 0;
+
+	eventQueue.push(myEvent);
+}
+
+
+// Rebuild the compiled connectivity:
+void Circuit::compileConnectivity(void) {
+	// Number the gates in order of ID:
+	compiledGates.clear();
+	compiledGateIDs.clear();
+	ID_SET< IDType > gateIDs = gateList.getIDs();
+	ID_SET< IDType >::iterator thisGateID = gateIDs.begin();
+	while(thisGateID != gateIDs.end()) {
+		Gate* myGate = gateList.get(*thisGateID);
+		myGate->compiledIndex = compiledGates.size();
+		compiledGates.push_back(myGate);
+		compiledGateIDs.push_back(*thisGateID);
+		thisGateID++;
+	}
+
+	// Number the wires in order of ID, and list each one's fanout gates:
+	compiledWires.clear();
+	fanoutStart.clear();
+	fanoutGates.clear();
+	ID_SET< IDType > wireIDs = wireList.getIDs();
+	ID_SET< IDType >::iterator thisWireID = wireIDs.begin();
+	while(thisWireID != wireIDs.end()) {
+		Wire* myWire = wireList.get(*thisWireID);
+		myWire->compiledIndex = compiledWires.size();
+		compiledWires.push_back(myWire);
+
+		unsigned long rowStart = fanoutGates.size();
+		fanoutStart.push_back(rowStart);
+		ID_SET< WireOutput >::iterator wireOutput = myWire->outputList.begin();
+		while(wireOutput != myWire->outputList.end()) {
+			// The outputs are sorted by gate, so a gate on more than one
+			// pin only has to be checked against the last one listed:
+			IDType gateIndex = gateList.get(wireOutput->gateID)->compiledIndex;
+			if((fanoutGates.size() == rowStart) || (fanoutGates.back() != gateIndex)) {
+				fanoutGates.push_back(gateIndex);
+			}
+			wireOutput++;
+		}
+		thisWireID++;
+	}
+	fanoutStart.push_back(fanoutGates.size());
+
+	// List each gate's input wires, and point the inputs at their
+	// wires' states:
+	gateInputWires.clear();
+	for(unsigned long i = 0; i < compiledGates.size(); i++) {
+		Gate* myGate = compiledGates[i];
+		myGate->firstInputSlot = gateInputWires.size();
+		for(PinType inputPin = 0; inputPin < myGate->inputList.size(); inputPin++) {
+			GateInput &theInput = myGate->inputList[inputPin];
+			if(theInput.wireID == ID_NONE) {
+				theInput.wireState = &unconnectedInputState;
+				gateInputWires.push_back(ID_NONE);
+			} else {
+				Wire* myWire = wireList.get(theInput.wireID);
+				theInput.wireState = &(myWire->wireState);
+				gateInputWires.push_back(myWire->compiledIndex);
+			}
+		}
+	}
+
+	connectivityChanged = false;
+
+	// The levelized schedule is built from the compiled connectivity:
+	scheduleChanged = true;
+	partitionChanged = true;
+}
+
+
+// Choose the engine that step() runs the simulation with:
+void Circuit::setEngine(EngineType newEngine) {
+	engine =(newEngine == ENGINE_LEVELIZED) ? ENGINE_LEVELIZED : ENGINE_EVENT;
+	scheduleChanged = true;
+}
+
+
+// Return the engine that is really running the circuit:
+EngineType Circuit::getActiveEngine(void) {
+	updateEngine();
+	return levelizedActive ? ENGINE_LEVELIZED : ENGINE_EVENT;
+}
+
+
+// Bring the compiled connectivity and the levelized schedule up to date,
+// and switch between the engines if needed:
+void Circuit::updateEngine(void) {
+	if(connectivityChanged) compileConnectivity();
+
+	if((engine == ENGINE_LEVELIZED) && scheduleChanged) {
+		scheduleValid = compileSchedule();
+		scheduleChanged = false;
+
+		// The schedule has changed, so work everything out again:
+		levelizedFullUpdate = true;
+	}
+
+	bool useLevelized = (engine == ENGINE_LEVELIZED) && scheduleValid;
+	if(useLevelized && !levelizedActive) {
+		enterLevelized();
+	} else if(!useLevelized && levelizedActive) {
+		leaveLevelized();
+	}
+}
+
+
+// Build the levelized schedule, and return false if the circuit can't be
+// levelized:
+bool Circuit::compileSchedule(void) {
+	scheduleClocks.clear();
+	scheduleState.clear();
+	scheduleCombinational.clear();
+
+	// Sort the gates by their roles, and find the gate driving each junction
+	// group. Tri-state outputs and groups with more than one driver are out:
+	vector< IDType > groupDriver(junctionGroups.size(), ID_NONE);
+	vector< IDType > combinationalGates;
+	for(IDType g = 0; g < compiledGates.size(); g++) {
+		Gate* myGate = compiledGates[g];
+		ScheduleRoleType role = myGate->getScheduleRole();
+		if(role == SCHEDULE_NONE) return false;
+
+		for(PinType pin = 0; pin < myGate->outputList.size(); pin++) {
+			const GateOutput &theOutput = myGate->outputList[pin];
+			if(theOutput.wireID == ID_NONE) continue;
+			if(theOutput.enableInput != PIN_NONE) return false;
+
+			IDType groupID = wireList.get(theOutput.wireID)->junctionGroup;
+			if((groupDriver[groupID] != ID_NONE) && (groupDriver[groupID] != g)) return false;
+			groupDriver[groupID] = g;
+		}
+
+		if(role == SCHEDULE_CLOCK) {
+			scheduleClocks.push_back(g);
+		} else if(role == SCHEDULE_STATE) {
+			scheduleState.push_back(g);
+		} else if(role == SCHEDULE_COMBINATIONAL) {
+			combinationalGates.push_back(g);
+		}
+	}
+
+	// The state elements have to be clocked straight from a CLOCK gate(or
+	// from nothing at all), not from other gates:
+	for(unsigned long i = 0; i < scheduleState.size(); i++) {
+		Gate* myGate = compiledGates[scheduleState[i]];
+		for(unsigned long j = 0; j < myGate->edgeTriggeredInputs.size(); j++) {
+			IDType wireID = myGate->inputList[myGate->edgeTriggeredInputs[j]].wireID;
+			if(wireID == ID_NONE) continue;
+
+			IDType driver = groupDriver[wireList.get(wireID)->junctionGroup];
+			if((driver != ID_NONE) && (compiledGates[driver]->getScheduleRole() != SCHEDULE_CLOCK)) return false;
+		}
+	}
+
+	// Put the combinational gates in the order that signals flow through
+	// them: each gate comes after the combinational gates that drive its
+	// inputs. If some are left over, the logic has a loop in it:
+	vector< unsigned long > waitingInputs(compiledGates.size(), 0);
+	vector< vector< IDType > > fanout(compiledGates.size());
+	for(unsigned long i = 0; i < combinationalGates.size(); i++) {
+		IDType g = combinationalGates[i];
+		Gate* myGate = compiledGates[g];
+		for(PinType pin = 0; pin < myGate->inputList.size(); pin++) {
+			IDType wireID = myGate->inputList[pin].wireID;
+			if(wireID == ID_NONE) continue;
+
+			IDType driver = groupDriver[wireList.get(wireID)->junctionGroup];
+			if((driver != ID_NONE) && (compiledGates[driver]->getScheduleRole() == SCHEDULE_COMBINATIONAL)) {
+				fanout[driver].push_back(g);
+				waitingInputs[g]++;
+			}
+		}
+	}
+	for(unsigned long i = 0; i < combinationalGates.size(); i++) {
+		if(waitingInputs[combinationalGates[i]] == 0) scheduleCombinational.push_back(combinationalGates[i]);
+	}
+	for(unsigned long next = 0; next < scheduleCombinational.size(); next++) {
+		const vector< IDType > &readers = fanout[scheduleCombinational[next]];
+		for(unsigned long r = 0; r < readers.size(); r++) {
+			if(--waitingInputs[readers[r]] == 0) scheduleCombinational.push_back(readers[r]);
+		}
+	}
+
+	return(scheduleCombinational.size() == combinationalGates.size());
+}
+
+
+// Take over from the event engine:
+void Circuit::enterLevelized(void) {
+	levelizedActive = true;
+	levelizedFullUpdate = true;
+
+	// Make the events that are still pending happen now, since the levelized
+	// engine settles everything straight away. The wake-ups aren't needed:
+	//(The gates have already counted the events as sent, so they wouldn't
+	// send them again.)
+	stepCount++;
+	while(!eventQueue.empty()) {
+		Event myEvent = eventQueue.top();
+		eventQueue.pop();
+
+		if(isCancelled(myEvent)) {
+			freeBusEventValue(myEvent);
+		} else if(myEvent.eventType != EVENT_WAKE_UP) {
+			applyEvent(myEvent);
+		}
+	}
+	busEventValues.clear();
+	freeBusEventValues.clear();
+}
+
+
+// Hand the circuit back to the event engine:
+void Circuit::leaveLevelized(void) {
+	levelizedActive = false;
+
+	// The wires are all settled, so only the self-scheduling gates need
+	// their wake-ups back:
+	ID_SET< IDType >::iterator scheduledGate = scheduledGates.begin();
+	while(scheduledGate != scheduledGates.end()) {
+		scheduleWakeUp(gateList.get(*scheduledGate), systemTime);
+		scheduledGate++;
+	}
+}
+
+
+// Run one timestep with the levelized engine:
+void Circuit::stepLevelized(ID_SET< IDType > *changedWires) {
+	stepCount++;
+	dirtyWires.clear();
+	changedWireList.clear();
+
+	// After a change to the circuit, work out all of the wires from their
+	// drivers, and bring all of the gates up to date before the clocks tick:
+	bool fullUpdate = levelizedFullUpdate || !gateUpdateList.empty() || !wireUpdateList.empty();
+	if(fullUpdate) {
+		for(IDType groupID = 0; groupID < junctionGroups.size(); groupID++) {
+			resolveJunctionGroupNow(groupID);
+		}
+		gateUpdateList.clear();
+		wireUpdateList.clear();
+		levelizedFullUpdate = false;
+
+		for(unsigned long i = 0; i < scheduleState.size(); i++) {
+			compiledGates[scheduleState[i]]->updateGate(compiledGateIDs[scheduleState[i]], this);
+		}
+		settleLevelized();
+	}
+
+	// Tick the clocks that have an edge now:
+	bool clockEdge = false;
+	for(unsigned long i = 0; i < scheduleClocks.size(); i++) {
+		Gate* myGate = compiledGates[scheduleClocks[i]];
+		if(fullUpdate || (myGate->getWakeUpTime(systemTime) == systemTime)) {
+			myGate->updateGate(compiledGateIDs[scheduleClocks[i]], this);
+			clockEdge = true;
+		}
+	}
+
+	if(clockEdge) {
+		// The state elements all see their inputs from before the edge, so
+		// their new outputs are held back until they have all been updated:
+		deferOutputs = true;
+		for(unsigned long i = 0; i < scheduleState.size(); i++) {
+			compiledGates[scheduleState[i]]->updateGate(compiledGateIDs[scheduleState[i]], this);
+		}
+		deferOutputs = false;
+		for(unsigned long i = 0; i < deferredOutputs.size(); i++) {
+			const ScheduledOutput &theOutput = deferredOutputs[i];
+			setWireInputNow(theOutput.wireID, theOutput.gateID, theOutput.gateOutputPin, theOutput.newState);
+		}
+		deferredOutputs.clear();
+
+		settleLevelized();
+	}
+
+	// A wire that changed more than once is only listed once:
+	sort(changedWireList.begin(), changedWireList.end());
+	changedWireList.erase(unique(changedWireList.begin(), changedWireList.end()), changedWireList.end());
+	if(changeLog != NULL) logChangedWires();
+
+	// Increment the system timer, because this timestep is complete:
+	systemTime++;
+
+	// Pass back the changed wires if they were asked for:
+	if(changedWires != NULL)
+		changedWires->insert(changedWireList.begin(), changedWireList.end());
+}
+
+
+// Let the combinational logic settle, in one pass through it in order. The
+// state elements get another look at their inputs afterwards, for their
+// asynchronous inputs(like "clear"), and if that changes anything the logic
+// has to settle again:
+void Circuit::settleLevelized(void) {
+	for(unsigned long pass = 0; pass <= scheduleState.size(); pass++) {
+		for(unsigned long i = 0; i < scheduleCombinational.size(); i++) {
+			compiledGates[scheduleCombinational[i]]->updateGate(compiledGateIDs[scheduleCombinational[i]], this);
+		}
+
+		unsigned long changedCount = changedWireList.size();
+		for(unsigned long i = 0; i < scheduleState.size(); i++) {
+			compiledGates[scheduleState[i]]->updateGate(compiledGateIDs[scheduleState[i]], this);
+		}
+		if(changedWireList.size() == changedCount) break;
+	}
+}
+
+
+// Set a gate output's state on its wire straight away, and work out the
+// state of the wire's junction group, for the levelized engine:
+void Circuit::setWireInputNow(IDType wireID, IDType gateID, PinType gateOutputPin, StateType newState) {
+	setWireInput(wireID, gateID, gateOutputPin, newState);
+	resolveJunctionGroupNow(wireList.get(wireID)->junctionGroup);
+}
+
+
+// Work out the state of a junction group straight away:
+void Circuit::resolveJunctionGroupNow(IDType groupID) {
+	JunctionGroup &wireGroup = junctionGroups[groupID];
+	StateType juncState = wireGroup.drivers.resolve();
+	for(unsigned long j = 0; j < wireGroup.wires.size(); j++) {
+		Wire* groupWire = wireList.get(wireGroup.wires[j]);
+		if(groupWire->getState() == juncState) continue;
+
+		groupWire->forceState(juncState);
+		changedWireList.push_back(wireGroup.wires[j]);
+	}
+}
+
+
+// Total up a junction group's drivers from the tallies of its wires:
+//(Used whenever a wire gains or loses an input.)
+void Circuit::countJunctionGroupDrivers(IDType groupID) {
+	JunctionGroup &theGroup = junctionGroups[groupID];
+	theGroup.drivers.clear();
+	for(unsigned long i = 0; i < theGroup.wires.size(); i++) {
+		theGroup.drivers.add(wireList.get(theGroup.wires[i])->getDrivers());
+	}
+}
+
+
@@ -1,240 +1,721 @@
-/*****************************************************************************
-   Project: CEDAR Logic Simulator
-   Copyright 2006 Cedarville University, Benjamin Sprague,
-                     Matt Lewellyn, and David Knierim
-   All rights reserved.
-   For license information see license.txt included with distribution.   
-*****************************************************************************/
-
-// logic_circuit.h: interface for the Circuit class.
-//
-//////////////////////////////////////////////////////////////////////
-
-#ifndef LOGIC_CIRCUIT_H
-#define LOGIC_CIRCUIT_H
-
-#include "logic_defaults.h"
-#include "logic_event.h"
-#include "logic_wire.h"
-#include "logic_gate.h"
-#include "logic_junction.h"
-
-#include<queue>
-#include<vector>
-
-#if _MSC_VER > 1000
-#pragma once
-#endif // _MSC_VER > 1000
-
-// A struct to hold parameters that need to be updated:
-struct changedParam {
-	IDType gateID;
-	string paramName;
-	changedParam(IDType nGateID, string nParamName) : gateID( nGateID ), paramName( nParamName ) {};
-};
-
-class Circuit  
-{
-friend class Junction;
-friend class Wire;
-public:
-
-// **************** The visible interface of the circuit ********************
-
-// ********** Circuit input methods *************
-	// Step the simulation forward by one timestep:
-	// If a pointer to a set is passed, then it will
-	// return a set of all the changed wires to the calling function.
-	void step( ID_SET< IDType > *changedWires = NULL);
-	
-	//***************************************
-	//Edit by Joshua Lansford 3/27/07
-	//purpose of edit: The ram gate needs to
-	//update its pop-up right after it loads
-	//even if it is paused.  Thus this method
-	//is created, so that the pop-ups
-	//can request that the core proces
-	//thegateUpdateList without advanceing
-	//the system time
-	void stepOnlyGates();
-	//End of Edit***************************
-	
-	// Create a new gate, and return its ID:
-	// NOTE: There should also be some way to pass
-	// parameters back and forth to gates that use them.
-	IDType newGate(string type, IDType gateID = ID_NONE );
-	
-	// Create a new wire and return its ID:
-	IDType newWire(IDType wireID = ID_NONE );
-
-	// Create a new junction and return its ID:
-	IDType newJunction(IDType juncID = ID_NONE );
-	
-	// Delete a gate, removing its connections to wires first:
-	void deleteGate(IDType theGate);
-	
-	// Delete a wire, removing its connections from gates first:
-	//(The implementation of this may require that wires keep track
-	// of their input gates.)
-	void deleteWire(IDType theWire);
-
-	// Delete a junction, removing all its connections from wires first:
-	void deleteJunction(IDType theJunc);
-
-/*OBSOLETE
-	// Connect an external event output to this wire, and return a new wire input ID
-	// which the output can connect to:
-	IDType connectExternalWireInput(IDType theWire);
-*/
-
-	// Connect a gate input to the output of a wire:
-	IDType connectGateInput(IDType gateID, string gateInputID, IDType wireID);
-	
-	// Connect a gate output to the input of a wire:
-	//(The wire will create one unique input for each unique gateID/gateOutputID combination.)
-	IDType connectGateOutput(IDType gateID, string gateOutputID, IDType wireID);
-	
-	// Disconnect a gate input from the output of a wire:
-	void disconnectGateInput(IDType gateID, string gateInputID);
-	
-	// Disconnect a gate output from the input of a wire:
-	void disconnectGateOutput(IDType gateID, string gateOutputID);
-
-	// Connect a junction to a wire:
-	void connectJunction(IDType juncID, IDType wireID);
-	
-	// Unhook a junction from a wire:
-	void disconnectJunction(IDType juncID, IDType wireID);
-
-	// Create an event and put it in the event queue:
-	void createEvent(TimeType eventTime, IDType wireID, IDType gateID, string gateOutputID, StateType newState);
-	
-	// Create an event that occurs at systemTime + delay:
-	TimeType createDelayedEvent(TimeType delay, IDType wireID, IDType gateID, string gateOutputID, StateType newState);
-
-	// Create Junction Event and put it in the event queue:
-	void createJunctionEvent(TimeType eventTime, IDType juncID, bool newState);
-	
-	// Clear out the event queue, destroying all events,
-	// and also erase all events in the gateUpdateList and wireUpdateList.
-	// This is used if we wanted a simulation where all of the wires
-	// start with "UNKNOWN" state and don't update until a signal
-	// from the outside world reaches them.
-	void destroyAllEvents(void);
-
-	// Set a gate parameter:
-	//(If the gate's parameter change requires the gate to be
-	// re-evaluated during the next cycle, then add it to the update list.)
-	void setGateParameter(IDType gateID, string paramName, string value);
-	void setGateInputParameter(IDType gateID, string inputID, string paramName, string value);
-	void setGateOutputParameter(IDType gateID, string outputID, string paramName, string value);
-
-	// Methods and data for handling parameter updates to be
-	// sent to the GUI from the logic core:
-	void addUpdateParam(IDType gateID, string paramName) {
-		paramUpdateList.push_back(changedParam( gateID, paramName) );
-	};
-
-	vector < changedParam > getParamUpdateList(void) {
-		return paramUpdateList;
-	};
-
-	void clearParamUpdateList(void) {
-		paramUpdateList.clear();
-	};
-
-protected:
-	vector < changedParam > paramUpdateList;
-public:
-
-// ************ Circuit inspection methods **************
-
-	// Get the IDs of all gates in the circuit:
-	ID_SET< IDType > getGateIDs(void) {
-		ID_SET< IDType > idList;
-		ID_MAP< IDType, GATE_PTR >::iterator thisGate = gateList.begin();
-		while(thisGate != gateList.end()) {
-			idList.insert(thisGate->first);
-			thisGate++;
-		}
-		return idList;
-	};
-
-	// Get the value of a gate parameter:
-	string getGateParameter(IDType gateID, string paramName);
-
-	// Get a wire state by ID:
-	StateType getWireState(IDType wireID);
-
-	// Get and set a junction's on/off toggle state:
-	void setJunctionState(IDType juncID, bool newState);
-	bool getJunctionState(IDType juncID);
-
-	// Return the current simulation time:
-	TimeType getSystemTime(void);
-
-	// Returns a list of all wires that are connected to this
-	// wire via junctions:
-	set< WIRE_PTR > getJunctionGroup(IDType wireID);
-	set< IDType > getJunctionGroupIDs(IDType wireID);
-	set< WIRE_PTR > getJunctionGroup(set< IDType >* wireGroupIDs);
-
-	// Returns maps of junction items for use in gate functions
-	ID_MAP< string, IDType >* getJunctionIDs(void) { return &junctionIDs; };
-	ID_MAP< string, unsigned long >* getJunctionUseCounter(void) { return &junctionUseCounter; };
-	
-// ************* End of the visible interface of the circuit ****************
-
-	Circuit();
-	virtual ~Circuit();
-
-protected:
-// For use by the Junction and Wire classes only:
-	WIRE_PTR getWire(IDType theWire) { return wireList[theWire]; };
-	JUNC_PTR getJunction(IDType theJunc) { return juncList[theJunc]; };
-
-private:
-	// All the gates in the circuit, and the ID counter:
-	ID_MAP< IDType, GATE_PTR > gateList;
-	IDType gateIDCount;
-
-	// All the wires in the circuit, and the ID counter:
-	ID_MAP< IDType, WIRE_PTR > wireList;
-	IDType wireIDCount;
-
-	// All the junctions in the circuit, and its ID counter:
-	ID_MAP< IDType, JUNC_PTR > juncList;
-	IDType juncIDCount;
-	
-	// This is the mapping of junction states, and how often each is used(# of gates):
-	ID_MAP< string, IDType > junctionIDs;
-	ID_MAP< string, unsigned long > junctionUseCounter;
-
-	// The gates that must be polled at each time step
-	// to allow them to create events:
-	// This is just a list of gate IDs to access from the gateList.
-	ID_SET< IDType > polledGates;
-
-	// This is the set of gates that needs to be forced into updating
-	// at the next call to step() due to one of their inputs being
-	// either connected or disconnected:
-	ID_SET< IDType > gateUpdateList;
-
-	// This is the set of wires that needs to be forced into updating
-	// at the next call to step() due to one of their inputs being
-	// either connected or disconnected:
-	ID_SET< IDType > wireUpdateList;
-
-	
-	// This is the event queue for the Circuit:
-	priority_queue< Event, vector< Event >, greater< Event > > eventQueue;
-	
-	// This is the current system time:
-	TimeType systemTime;
-};
-
-
-// An operator to sort events by their event time. Used by the eventQueue;
-bool operator >(const Event &left, const Event &right);
-
-#endif // LOGIC_CIRCUIT_H
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.   
+*****************************************************************************/
+
+// logic_circuit.h: interface for the Circuit class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef LOGIC_CIRCUIT_H
+#define LOGIC_CIRCUIT_H
+
+#include "logic_defaults.h"
+#include "logic_event.h"
+#include "logic_event_queue.h"
+#include "logic_wire.h"
+#include "logic_gate.h"
+#include "logic_junction.h"
+#include "logic_id_table.h"
+#include "logic_thread_pool.h"
+#include "logic_stats.h"
+#include "logic_trace.h"
+
+#include<vector>
+
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+// The fewest gates that step() will update on more than one thread. Below
+// this, waking the threads up costs more than it saves:
+#define PARALLEL_GATE_THRESHOLD 64
+
+class PartitionEngine;
+
+// A struct to hold parameters that need to be updated:
+struct changedParam {
+	IDType gateID;
+	string paramName;
+	changedParam(IDType nGateID, string nParamName) : gateID( nGateID ), paramName( nParamName ) {};
+};
+
+// A change written to the Circuit's change log(see setChangeLog()): either a
+// wire's new state, or(with a paramName) a gate's parameter change, and the
+// timestep it happened in:
+struct LoggedChange {
+	TimeType changeTime;
+	IDType id;
+	string paramName;
+	StateType newState;
+	LoggedChange(TimeType nChangeTime, IDType nID, string nParamName, StateType nNewState) :
+		changeTime( nChangeTime ), id( nID ), paramName( nParamName ), newState( nNewState ) {};
+
+	bool operator<(const LoggedChange &other) const {
+		if(changeTime != other.changeTime) return(changeTime < other.changeTime);
+		if(id != other.id) return(id < other.id);
+		if(paramName != other.paramName) return(paramName < other.paramName);
+		return(newState < other.newState);
+	};
+	bool operator==(const LoggedChange &other) const {
+		return(changeTime == other.changeTime) && (id == other.id) && (paramName == other.paramName) && (newState == other.newState);
+	};
+};
+
+// Compare two change logs, leaving out the order of the changes within each
+// timestep, which is up to the engine. Up to maxReports of the changes that
+// are only in one of the logs are written to out, and the number of them is
+// returned:
+unsigned long compareChangeLogs(vector< LoggedChange > firstLog, vector< LoggedChange > secondLog, ostream &out, unsigned long maxReports);
+
+class Circuit  
+{
+friend class Junction;
+friend class Wire;
+friend class VectorSimulator;
+friend class PartitionEngine;
+public:
+
+// **************** The visible interface of the circuit ********************
+
+// ********** Circuit input methods *************
+	// Step the simulation forward by one timestep:
+	// If a pointer to a set is passed, then it will
+	// return a set of all the changed wires to the calling function.
+	//(Only the wires whose state is different from the last step are
+	// returned, and only their gates are updated.)
+	void step( ID_SET< IDType > *changedWires = NULL);
+
+	// Return the wires whose state changed in the last call to step():
+	//(The list belongs to the Circuit and is reused by the next step, so
+	// this is the cheap way to find out what changed.)
+	const vector< IDType >& getChangedWires(void) { return changedWireList; };
+
+	// Run the simulation until systemTime reaches endTime, stepping only
+	// through the timesteps where something can happen and skipping over
+	// the idle time in between:
+	//(changedWires collects the changed wires of all of the steps taken.)
+	void runUntil(TimeType endTime, ID_SET< IDType > *changedWires = NULL);
+
+	// Run the simulation forward by dt timesteps, the same way as runUntil():
+	void advance(TimeType dt, ID_SET< IDType > *changedWires = NULL);
+
+	// Jump systemTime forward over the idle timesteps, but never past
+	// endTime. Returns the number of timesteps that were skipped:
+	TimeType skipIdleTime(TimeType endTime);
+
+	// Return the earliest time at or after systemTime at which step() has
+	// something to do, or TIME_NONE if the circuit is completely idle:
+	TimeType getNextActiveTime(void);
+	
+	//***************************************
+	//Edit by Joshua Lansford 3/27/07
+	//purpose of edit: The ram gate needs to
+	//update its pop-up right after it loads
+	//even if it is paused.  Thus this method
+	//is created, so that the pop-ups
+	//can request that the core proces
+	//thegateUpdateList without advanceing
+	//the system time
+	void stepOnlyGates();
+	//End of Edit***************************
+	
+	// Create a new gate, and return its ID:
+	// NOTE: There should also be some way to pass
+	// parameters back and forth to gates that use them.
+	IDType newGate(string type, IDType gateID = ID_NONE );
+	
+	// Create a new wire and return its ID:
+	IDType newWire(IDType wireID = ID_NONE );
+
+	// Create a new junction and return its ID:
+	IDType newJunction(IDType juncID = ID_NONE );
+	
+	// Delete a gate, removing its connections to wires first:
+	void deleteGate(IDType theGate);
+	
+	// Delete a wire, removing its connections from gates first:
+	//(The implementation of this may require that wires keep track
+	// of their input gates.)
+	void deleteWire(IDType theWire);
+
+	// Delete a junction, removing all its connections from wires first:
+	void deleteJunction(IDType theJunc);
+
+/*OBSOLETE
+	// Connect an external event output to this wire, and return a new wire input ID
+	// which the output can connect to:
+	IDType connectExternalWireInput(IDType theWire);
+*/
+
+	// Connect a gate input to the output of a wire:
+	IDType connectGateInput(IDType gateID, string gateInputID, IDType wireID);
+	
+	// Connect a gate output to the input of a wire:
+	//(The wire will create one unique input for each unique gateID/gateOutputID combination.)
+	IDType connectGateOutput(IDType gateID, string gateOutputID, IDType wireID);
+	
+	// Disconnect a gate input from the output of a wire:
+	void disconnectGateInput(IDType gateID, string gateInputID);
+	
+	// Disconnect a gate output from the input of a wire:
+	void disconnectGateOutput(IDType gateID, string gateOutputID);
+
+	// Connect a junction to a wire:
+	void connectJunction(IDType juncID, IDType wireID);
+	
+	// Unhook a junction from a wire:
+	void disconnectJunction(IDType juncID, IDType wireID);
+
+	// Create a new bus wire with numLines lines and return its ID. Each line
+	// is an ordinary wire(see getBusLines()), so single-bit pins and junctions
+	// connect to the lines directly. A gate's output bus that is connected to
+	// the bus wire as a whole sends one bus event for all of its lines that
+	// change, instead of an event for each line:
+	IDType newBusWire(unsigned long numLines, IDType busID = ID_NONE);
+
+	// Delete a bus wire, along with all of its lines:
+	void deleteBusWire(IDType busID);
+
+	// Return the wire IDs of a bus wire's lines, from line 0 up:
+	vector< IDType > getBusLines(IDType busID);
+
+	// Connect the inputs "busName_0" through "busName_x" of a gate to the
+	// lines of a bus wire:
+	void connectGateInputBus(IDType gateID, string busName, IDType busID);
+
+	// Connect the outputs "busName_0" through "busName_x" of a gate to the
+	// lines of a bus wire, as a single output bus:
+	//(Disconnecting any of the outputs breaks the bus back up into lines.)
+	void connectGateOutputBus(IDType gateID, string busName, IDType busID);
+
+	// Create an event and put it in the event queue:
+	//(The event goes to the wire that the gate output is connected to.)
+	void createEvent(TimeType eventTime, IDType gateID, PinType gateOutputPin, StateType newState);
+	
+	// Create an event that occurs at systemTime + delay:
+	TimeType createDelayedEvent(TimeType delay, IDType wireID, IDType gateID, PinType gateOutputPin, StateType newState);
+
+	// Create Junction Event and put it in the event queue:
+	void createJunctionEvent(TimeType eventTime, IDType juncID, bool newState);
+
+	// Create a bus event for a gate's connected output bus, which changes the
+	// lines in changedLines to their states in newState:
+	void createBusEvent(TimeType eventTime, IDType gateID, unsigned long busIndex, const BusPlanes &newState, unsigned long changedLines);
+	
+	// Clear out the event queue, destroying all events,
+	// and also erase all events in the gateUpdateList and wireUpdateList.
+	// This is used if we wanted a simulation where all of the wires
+	// start with "UNKNOWN" state and don't update until a signal
+	// from the outside world reaches them.
+	void destroyAllEvents(void);
+
+	// Set a gate parameter:
+	//(If the gate's parameter change requires the gate to be
+	// re-evaluated during the next cycle, then add it to the update list.)
+	void setGateParameter(IDType gateID, string paramName, string value);
+	void setGateInputParameter(IDType gateID, string inputID, string paramName, string value);
+	void setGateOutputParameter(IDType gateID, string outputID, string paramName, string value);
+
+	// Methods and data for handling parameter updates to be
+	// sent to the GUI from the logic core:
+	void addUpdateParam(IDType gateID, string paramName) {
+		addUpdateParam(gateID, paramName, systemTime);
+	};
+
+	// The same, for a change that the partitioned engine made at paramTime:
+	void addUpdateParam(IDType gateID, string paramName, TimeType paramTime) {
+		paramUpdateList.push_back(changedParam( gateID, paramName) );
+		if(changeLog != NULL) changeLog->push_back(LoggedChange(paramTime, gateID, paramName, UNKNOWN));
+	};
+
+	vector < changedParam > getParamUpdateList(void) {
+		return paramUpdateList;
+	};
+
+	void clearParamUpdateList(void) {
+		paramUpdateList.clear();
+	};
+
+	// Write every wire change and parameter change from now on to a change
+	// log, with the timestep that it happened in(or stop, with NULL). Runs of
+	// the same circuit on different engines can then be checked against each
+	// other with compareChangeLogs():
+	void setChangeLog(vector< LoggedChange >* newChangeLog) {
+		changeLog = newChangeLog;
+	};
+
+protected:
+	vector < changedParam > paramUpdateList;
+
+	// The change log, or NULL:
+	vector< LoggedChange >* changeLog;
+
+	// Log the wires in changedWireList at the end of a step:
+	void logChangedWires(void);
+public:
+
+// ************ Circuit inspection methods **************
+
+	// Get the IDs of all gates in the circuit:
+	ID_SET< IDType > getGateIDs(void) {
+		return gateList.getIDs();
+	};
+
+	// Get the value of a gate parameter:
+	string getGateParameter(IDType gateID, string paramName);
+
+	// Get a wire state by ID:
+	StateType getWireState(IDType wireID);
+
+	// Get and set a junction's on/off toggle state:
+	void setJunctionState(IDType juncID, bool newState);
+	bool getJunctionState(IDType juncID);
+
+	// Return the current simulation time:
+	TimeType getSystemTime(void);
+
+	// Return the number of events(wire, junction and bus events and gate
+	// wake-ups) that the event engines have made happen so far. The cancelled
+	// events aren't counted, and neither is the levelized engine's work:
+	unsigned long long getEventCount(void) { return eventCount; };
+
+	// Return the number of gate updates so far, by all of the engines, added
+	// up over the gates that are in the circuit now:
+	unsigned long long getGateUpdateCount(void);
+
+	// Turn on or off the counters for the event engine's step()(see
+	// CircuitStats). They are only there if the logic core is compiled with
+	// LOGIC_STATS; otherwise the stats stay empty and getStatsEnabled()
+	// always returns false. The levelized engine's steps and the partitioned
+	// runs aren't counted:
+	void setStatsEnabled(bool enable);
+	bool getStatsEnabled(void) { return statsEnabled; };
+
+	// The counters for the last call to step(), and for all of the steps
+	// since the stats were last cleared:
+	const CircuitStats& getStepStats(void) { return stepStats; };
+	const CircuitStats& getTotalStats(void) { return totalStats; };
+	void clearStats(void);
+
+	// The gate types that have been made, in the order of
+	// CircuitStats::gatesByType:
+	const vector< string >& getGateTypeNames(void) { return gateTypeNames; };
+
+	// Turn on or off the gate profiler, which times every gate update, by all
+	// of the engines. Like the stats, it is only there if the logic core is
+	// compiled with LOGIC_STATS:
+	void setProfiling(bool enable);
+	bool getProfiling(void) { return profiling; };
+
+	// Zero the gate profile:
+	void clearProfile(void);
+
+	// Return the gate profile for the gates that are in the circuit now, by
+	// gate type and by gate, each ranked from the most time spent down. The
+	// gates that weren't updated are left out:
+	vector< GateProfileEntry > getGateTypeProfile(void);
+	vector< GateProfileEntry > getGateProfile(void);
+
+	// Set and get the delay mode(DELAY_TRANSPORT or DELAY_INERTIAL) used for
+	// junctions and for the gates that don't set their own "DELAY_MODE":
+	void setDelayMode(DelayModeType newMode) {
+		delayMode =(newMode == DELAY_INERTIAL) ? DELAY_INERTIAL : DELAY_TRANSPORT;
+	};
+	DelayModeType getDelayMode(void) { return delayMode; };
+
+	// Choose the engine(ENGINE_EVENT or ENGINE_LEVELIZED) that step() runs the
+	// simulation with. The levelized engine only takes on synchronous circuits:
+	// every gate has to be combinational, a state element(JKFF or REGISTER)
+	// clocked straight from a CLOCK gate, a CLOCK gate or a TO/FROM, with no
+	// tri-state outputs, no wires with more than one driver, and no loops in
+	// the combinational logic. It does without the event queue: at each clock
+	// edge the state elements are updated together, and then the combinational
+	// logic is updated once, in order, and settles with no gate delays. For any
+	// other circuit, the Circuit falls back to the event engine, and it checks
+	// again whenever the circuit's connections change:
+	void setEngine(EngineType newEngine);
+	EngineType getEngine(void) { return engine; };
+
+	// Return the engine that is really running the circuit:
+	EngineType getActiveEngine(void);
+
+	// Set the number of threads that the event engine updates the gates on,
+	// in timesteps that have at least PARALLEL_GATE_THRESHOLD gates to
+	// update. The gates' events and parameter changes are held back and
+	// then made in gate ID order, so the simulation comes out the same
+	// whatever the number of threads. 1(the default) updates the gates on
+	// the calling thread only:
+	void setThreadCount(unsigned long newCount) { threadPool.setThreadCount(newCount); };
+	unsigned long getThreadCount(void) { return threadPool.getThreadCount(); };
+
+	// Set the number of partitions that runUntil() and advance() cut the
+	// circuit into, to run the event simulation on the thread pool with one
+	// event queue per partition(see PartitionEngine). The partitions only pass
+	// events to each other, at least one gate delay ahead, so the wires come
+	// out the same as with the sequential engine. The gates' parameter changes
+	// are passed on in time order, but within a timestep they come partition
+	// by partition. 1(the default) runs the whole circuit sequentially, and
+	// so does step() always. A circuit that can't be partitioned is run
+	// sequentially too:
+	void setPartitionCount(unsigned long newCount);
+	unsigned long getPartitionCount(void) { return partitionCount; };
+
+	// Was the last call to runUntil() or advance() run partitioned?
+	bool ranPartitioned(void) { return lastRunPartitioned; };
+
+	// Returns a list of all wires that are connected to this
+	// wire via junctions:
+	set< WIRE_PTR > getJunctionGroup(IDType wireID);
+	set< IDType > getJunctionGroupIDs(IDType wireID);
+	set< WIRE_PTR > getJunctionGroup(set< IDType >* wireGroupIDs);
+
+	// Returns maps of junction items for use in gate functions
+	ID_MAP< string, IDType >* getJunctionIDs(void) { return &junctionIDs; };
+	ID_MAP< string, unsigned long >* getJunctionUseCounter(void) { return &junctionUseCounter; };
+	
+// ************* End of the visible interface of the circuit ****************
+
+	Circuit();
+	virtual ~Circuit();
+
+protected:
+// For use by the Junction and Wire classes only:
+	WIRE_PTR getWire(IDType theWire) { return wireList.getPtr(theWire); };
+	JUNC_PTR getJunction(IDType theJunc) { return juncList.getPtr(theJunc); };
+
+private:
+	// All the gates in the circuit, and the ID counter:
+	//(The tables are indexed by ID, so the simulation loops can get
+	// at a gate, wire or junction without a map lookup.)
+	IDTable< Gate > gateList;
+	IDType gateIDCount;
+
+	// All the wires in the circuit, and the ID counter:
+	IDTable< Wire > wireList;
+	IDType wireIDCount;
+
+	// All the junctions in the circuit, and its ID counter:
+	IDTable< Junction > juncList;
+	IDType juncIDCount;
+	
+	// The junction groups: each wire belongs to exactly one group, which
+	// holds all of the wires that are tied together by enabled junctions.
+	// The groups are only changed when a junction is enabled or disabled or
+	// gains or loses a wire, so step() can look them up instead of searching
+	// through the junctions. Unused groups are empty and are on the free list.
+	// Each group also keeps a tally of the states driven by all of its wires'
+	// inputs, which step() keeps up to date as the events come in:
+	struct JunctionGroup {
+		vector< IDType > wires;
+		DriverCount drivers;
+		unsigned long long stepMark; // The last step that worked out the group's state.
+		JunctionGroup() : stepMark(0) {};
+	};
+	vector< JunctionGroup > junctionGroups;
+	vector< IDType > freeJunctionGroups;
+
+	// Make a new, empty junction group and return its ID:
+	IDType newJunctionGroup(void);
+
+	// Put two wires' junction groups together:
+	void mergeJunctionGroups(IDType wireA, IDType wireB);
+
+	// Break a junction group back up into the groups that are still
+	// tied together after a junction was disabled or lost a wire:
+	void splitJunctionGroup(IDType groupID);
+
+	// Total up a junction group's drivers from the tallies of its wires:
+	void countJunctionGroupDrivers(IDType groupID);
+
+	// This is the mapping of junction states, and how often each is used(# of gates):
+	ID_MAP< string, IDType > junctionIDs;
+	ID_MAP< string, unsigned long > junctionUseCounter;
+
+	// The self-scheduling gates(CLOCK and PULSE), which create events on
+	// their own at the times they choose, rather than when their inputs
+	// change. Each one has an event source for its wake-up events, and at
+	// most one wake-up event pending in the queue.
+	ID_SET< IDType > scheduledGates;
+
+	// Make a gate self-scheduling, and give it its first wake-up:
+	void setUpWakeUps(IDType gateID);
+
+	// Replace a self-scheduling gate's pending wake-up event with one for
+	// the next time, at or after fromTime, that the gate asks for:
+	//(Does nothing for other gates.)
+	void scheduleWakeUp(Gate* theGate, TimeType fromTime);
+
+	// This is the set of gates that needs to be forced into updating
+	// at the next call to step() due to one of their inputs being
+	// either connected or disconnected:
+	ID_SET< IDType > gateUpdateList;
+
+	// This is the set of wires that needs to be forced into updating
+	// at the next call to step() due to one of their inputs being
+	// either connected or disconnected:
+	//(It's a plain list, since step() sorts out the duplicates.)
+	vector< IDType > wireUpdateList;
+
+	
+	// The gate outputs and junctions that events are sent from. Events
+	// only carry the index of their source, to keep them small. Each gate
+	// output gets a source when it is connected to a wire, and each junction
+	// gets one when it is created. Unused sources are on the free list.
+	//
+	// A source's events are cancelled by moving its cancelSequence up to the
+	// next event sequence number: the events made before that are left in the
+	// queue, and thrown away when they come up.
+	struct EventSource {
+		IDType gateID;
+		PinType gateOutputPin;
+		IDType wireID;
+		IDType junctionID;
+		unsigned long outputBus; // For a gate's connected output bus.
+		unsigned long long cancelSequence;
+		EventSource() : gateID(ID_NONE), gateOutputPin(PIN_NONE), wireID(ID_NONE), junctionID(ID_NONE), outputBus(ID_NONE), cancelSequence(0) {};
+	};
+	vector< EventSource > eventSources;
+	vector< SourceType > freeEventSources;
+
+	// Make a new event source and return its index:
+	SourceType newEventSource(void);
+
+	// Put an event source back on the free list:
+	void freeEventSource(SourceType source);
+
+	// Cancel all of the events in the queue from an event source:
+	void cancelEvents(SourceType source) {
+		eventSources[source].cancelSequence = eventSequence;
+	};
+
+	// Has an event been cancelled?
+	bool isCancelled(const Event &theEvent) {
+		return(theEvent.sequence < eventSources[theEvent.source].cancelSequence);
+	};
+
+	// Throw away the cancelled events at the front of the event queue:
+	void discardCancelledEvents(void);
+
+	// Change the state that a gate output is driving onto a wire, and mark the
+	// wire as dirty for step():
+	void setWireInput(IDType wireID, IDType gateID, PinType gateOutputPin, StateType newState);
+
+	// The bus wires, each a list of its lines' wire IDs, and the bus ID counter:
+	ID_MAP< IDType, vector< IDType > > busList;
+	IDType busIDCount;
+
+	// The line states carried by the bus events in the queue. A bus event
+	// holds the index of its entry(Event::busValue), which goes back on the
+	// free list when the event comes off the queue:
+	struct BusEventValue {
+		BusPlanes newState;
+		unsigned long changedLines;
+	};
+	vector< BusEventValue > busEventValues;
+	vector< unsigned short > freeBusEventValues;
+
+	// Let go of the bus event value of an event that is off the queue:
+	void freeBusEventValue(const Event &theEvent) {
+		if(theEvent.eventType == EVENT_BUS) freeBusEventValues.push_back(theEvent.busValue);
+	};
+
+	// Break a gate's output bus back up into lines that send their own events:
+	void disconnectOutputBus(Gate* theGate, unsigned long busIndex);
+
+	// The compiled connectivity of the circuit, which step() and the gates
+	// use instead of the wires' and gates' own sets and maps. The wires and
+	// gates are numbered in order of ID, and the connections are stored in
+	// compressed sparse row form: the fanout gates of wire index w are
+	// fanoutGates[fanoutStart[w]] up to(but not including)
+	// fanoutGates[fanoutStart[w + 1]], each gate listed once. A gate's input
+	// wires are the wire indexes in gateInputWires starting at the gate's
+	// firstInputSlot, one per input pin(ID_NONE for an unconnected pin).
+	// Compiling also points each connected gate input's wireState at its
+	// wire's state, so that the gates can read their inputs directly.
+	//
+	// Anything that adds or removes a gate, wire or gate input marks it out
+	// of date, and it is rebuilt at the start of the next step.
+	vector< Wire* > compiledWires;
+	vector< Gate* > compiledGates;
+	vector< IDType > compiledGateIDs;
+	vector< unsigned long > fanoutStart;
+	vector< IDType > fanoutGates;
+	vector< IDType > gateInputWires;
+	bool connectivityChanged;
+
+	// Rebuild the compiled connectivity:
+	void compileConnectivity(void);
+
+	// Make a wire or junction event happen:
+	//(Wake-up events are handled in step().)
+	void applyEvent(const Event &theEvent);
+
+	// The engine chosen with setEngine(), and whether the levelized engine is
+	// really running the circuit:
+	EngineType engine;
+	bool levelizedActive;
+
+	// The levelized engine's schedule: the compiled indexes of the CLOCK
+	// gates, the state elements, and the combinational gates in the order
+	// that signals flow through them. scheduleChanged marks it out of date:
+	vector< IDType > scheduleClocks;
+	vector< IDType > scheduleState;
+	vector< IDType > scheduleCombinational;
+	bool scheduleChanged;
+	bool scheduleValid;
+
+	// Set when all of the wires and gates need working out again at the
+	// next levelized step:
+	bool levelizedFullUpdate;
+
+	// The gate outputs set while the state elements are being updated, which
+	// are held back until all of them have seen their inputs:
+	struct ScheduledOutput {
+		IDType wireID;
+		IDType gateID;
+		PinType gateOutputPin;
+		StateType newState;
+		ScheduledOutput(IDType wireID, IDType gateID, PinType gateOutputPin, StateType newState) :
+			wireID(wireID), gateID(gateID), gateOutputPin(gateOutputPin), newState(newState) {};
+	};
+	vector< ScheduledOutput > deferredOutputs;
+	bool deferOutputs;
+
+	// Bring the compiled connectivity and the levelized schedule up to date,
+	// and switch between the engines if needed:
+	void updateEngine(void);
+
+	// Build the levelized schedule, and return false if the circuit can't be
+	// levelized:
+	bool compileSchedule(void);
+
+	// Take over from the event engine, or hand the circuit back to it:
+	void enterLevelized(void);
+	void leaveLevelized(void);
+
+	// Run one timestep with the levelized engine:
+	void stepLevelized(ID_SET< IDType > *changedWires);
+
+	// Let the combinational logic and the state elements' asynchronous
+	// inputs settle:
+	void settleLevelized(void);
+
+	// Set a gate output's state on its wire straight away, and work out the
+	// state of the wire's junction group, for the levelized engine:
+	void setWireInputNow(IDType wireID, IDType gateID, PinType gateOutputPin, StateType newState);
+
+	// Work out the state of a junction group straight away:
+	void resolveJunctionGroupNow(IDType groupID);
+
+	// The work lists for step(). They are kept from step to step so that
+	// step() doesn't have to allocate anything once they have grown to fit
+	// the circuit. Instead of being looked up in sets, the wires, gates and
+	// junction groups are stamped with the number of the step that last put
+	// them in a list(see stepCount):
+	//(dirtyWires are the wires that might change state, changedWireList are
+	// the ones that really did, and changedGates are the compiled indexes of
+	// the gates to update.)
+	vector< IDType > dirtyWires;
+	vector< IDType > changedWireList;
+	vector< IDType > changedGates;
+
+	// Update the gates in changedGates across the thread pool, and then make
+	// their events and parameter changes in the order of changedGates:
+	void updateGatesInParallel(void);
+
+	// Update a range of changedGates on one of the pool's threads, holding
+	// their calls to the Circuit in the thread's list:
+	void updateGateRange(unsigned long threadIndex, unsigned long first, unsigned long last);
+
+	// The thread pool's task for updateGatesInParallel():
+	class GateUpdateTask : public ThreadTask {
+	public:
+		GateUpdateTask(Circuit* newCircuit) : theCircuit(newCircuit) {};
+		void runItems(unsigned long threadIndex, unsigned long first, unsigned long last) {
+			theCircuit->updateGateRange(threadIndex, first, last);
+		};
+	private:
+		Circuit* theCircuit;
+	};
+	friend class GateUpdateTask;
+
+	// Where each gate in changedGates held its calls while it was updated:
+	// calls first to last - 1 of heldCalls[thread]. A gate that can't be
+	// updated in parallel is marked with thread = ID_NONE, and updated
+	// during the merge instead:
+	struct HeldGateCalls {
+		unsigned long thread;
+		unsigned long first;
+		unsigned long last;
+	};
+
+	ThreadPool threadPool;
+	vector< vector< GateCall > > heldCalls;
+	vector< HeldGateCalls > heldGateCalls;
+
+	// The partitioned engine, with the number of partitions to use, and
+	// whether it needs to cut the circuit up again:
+	PartitionEngine* partitionEngine;
+	unsigned long partitionCount;
+	bool partitionChanged;
+	bool lastRunPartitioned;
+
+	// Run until endTime with the partitioned engine, if it can:
+	bool runPartitioned(TimeType endTime, ID_SET< IDType > *changedWires);
+
+	// The number of calls to step() so far, used as the stamp:
+	unsigned long long stepCount;
+
+	// This is the event queue for the Circuit:
+	EventQueue eventQueue;
+
+	// The number of events created so far, used to keep the events that
+	// happen at the same time in the order they were made:
+	unsigned long long eventSequence;
+
+	// The number of events made to happen so far(see getEventCount()):
+	unsigned long long eventCount;
+
+	// The step() counters(see getStepStats()), and the names of the gate
+	// types that Gate::typeIndex numbers:
+	bool statsEnabled;
+	CircuitStats stepStats;
+	CircuitStats totalStats;
+	vector< string > gateTypeNames;
+
+	// Whether the gates time their updates(see setProfiling()):
+	bool profiling;
+
+	// Whether this step's phases are being timed, for the stats or the
+	// timeline, and when the current phase started:
+	bool phaseTiming;
+	double statsPhaseStart;
+
+	// Count a gate update in the step's stats:
+	void countGateStat(Gate* theGate) {
+		stepStats.gatesEvaluated++;
+		stepStats.gatesByType[theGate->typeIndex]++;
+	};
+
+	// Add the time since statsPhaseStart to a phase of the step's stats and
+	// to the timeline, and start timing the next phase:
+	void endStatsPhase(unsigned long phase) {
+		double now = statsTime();
+		stepStats.phaseTime[phase] += now - statsPhaseStart;
+		if(traceIsOn()) traceEvent(statsPhaseNames[phase], statsPhaseStart, now);
+		statsPhaseStart = now;
+	};
+
+	// This is the current system time:
+	TimeType systemTime;
+
+	// The delay mode for gates that don't choose their own:
+	DelayModeType delayMode;
+};
+
+
+#endif // LOGIC_CIRCUIT_H
@@ -1,90 +1,130 @@
-/*****************************************************************************
-   Project: CEDAR Logic Simulator
-   Copyright 2006 Cedarville University, Benjamin Sprague,
-                     Matt Lewellyn, and David Knierim
-   All rights reserved.
-   For license information see license.txt included with distribution.   
-*****************************************************************************/
-
-// logic_defaults.h: Default standards for the logic engine.
-// Ben Sprague, 10-15-2005
-
-#ifndef LOGIC_DEFAULTS_H
-#define LOGIC_DEFAULTS_H
-
-#include "../GUI/product.h"
-#include <limits.h>
-// Warning message macro:
-#ifndef _PRODUCTION_
-#define WARNING(message) \
-	*logiclog << "Warning: " << message << endl << flush
-#else
-#define WARNING(message) \
-	;
-#endif
-
-#include <fstream>
-using namespace std;
-extern ofstream* logiclog;
-
-// The number of states in the simulator:
-#define NUM_STATES 5
-
-// The states defined in truth tables:
-#define ZERO     0
-#define ONE      1
-#define HI_Z     2
-#define UNKNOWN  4
-#define CONFLICT 5
-
-// Type definitions:
-
-// Wire state type:
-typedef unsigned char StateType;
-
-// The type used to store logic time values:
-// Note that we don't make any effort to avoid the time counter from over-flowing.
-// For this to happen, even if the machine only does 32-bit long long types, 
-// the simulation would have to run constantly for 50 days straight
-// even if a time step were taken once per milisecond. So we don't worry about it.
-//typedef unsigned long long TimeType;
-typedef unsigned long long TimeType;
-
-// The time that represents an unitialized time variable:
-#define TIME_NONE ULONG_LONG_MAX
-#define DEFAULT_GATE_DELAY 1
-
-// The type used for internal wire and gate and input IDs:
-// Note that we also don't worry about IDType running out of spaces, because an
-// unsigned long can memory reference the entire memory space anyhow. ,'o)
-//WARNING:(Unless of course, a loaded file gives you an ID that is near the
-// top of unsigned long's range to begin with!)
-typedef unsigned long IDType;
-
-// The ID that represents an unconnected wire or gate:
-#define ID_NONE ULONG_MAX
-
-// Pair-associative and associative containers for IDs:
-#define ID_MAP map
-#include<map>
-
-#define ID_SET set
-#include<set>
-
-#define EVENT_LIST vector
-#include<vector>
-
-#define WIRE_MAP map
-
-// Gate and wire pointer definitions:
-#include "counted_pointer.h"
-
-#define GATE_PTR counted_ptr< Gate >
-#define WIRE_PTR counted_ptr< Wire >
-#define JUNC_PTR counted_ptr< Junction >
-
-// Allow use of STL objects:
-#include <string>
-using namespace std;
-
-#endif // LOGIC_DEFAULTS_H
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.   
+*****************************************************************************/
+
+// logic_defaults.h: Default standards for the logic engine.
+// Ben Sprague, 10-15-2005
+
+#ifndef LOGIC_DEFAULTS_H
+#define LOGIC_DEFAULTS_H
+
+#include "../GUI/product.h"
+#include <limits.h>
+// Warning message macro:
+#ifndef _PRODUCTION_
+#define WARNING(message) \
+	*logiclog << "Warning: " << message << endl << flush
+#else
+#define WARNING(message) \
+	;
+#endif
+
+#include <fstream>
+using namespace std;
+extern ofstream* logiclog;
+
+// The number of states in the simulator:
+#define NUM_STATES 5
+
+// The states defined in truth tables:
+#define ZERO     0
+#define ONE      1
+#define HI_Z     2
+#define UNKNOWN  4
+#define CONFLICT 5
+
+// Type definitions:
+
+// Wire state type:
+typedef unsigned char StateType;
+
+// The type used to store logic time values:
+// Note that we don't make any effort to avoid the time counter from over-flowing.
+// For this to happen, even if the machine only does 32-bit long long types, 
+// the simulation would have to run constantly for 50 days straight
+// even if a time step were taken once per milisecond. So we don't worry about it.
+//typedef unsigned long long TimeType;
+typedef unsigned long long TimeType;
+
+// The time that represents an unitialized time variable:
+#define TIME_NONE ULONG_LONG_MAX
+#define DEFAULT_GATE_DELAY 1
+
+// How a gate output's delay treats changes that come faster than the delay.
+// Transport delay passes every change along. Inertial delay drops a change
+// that is still pending when the next one is made, which filters out glitches
+// shorter than the delay:
+typedef unsigned char DelayModeType;
+#define DELAY_DEFAULT   0 // For gates: use the Circuit's delay mode.
+#define DELAY_TRANSPORT 1
+#define DELAY_INERTIAL  2
+
+// The engines that the Circuit can run a simulation with. The event engine
+// handles any circuit. The levelized engine handles synchronous circuits only,
+// working out each clock edge in one pass through the gates in order; the
+// Circuit falls back to the event engine for circuits that it can't handle:
+typedef unsigned char EngineType;
+#define ENGINE_EVENT     0
+#define ENGINE_LEVELIZED 1
+
+// How the levelized engine treats a gate(see Gate::getScheduleRole()):
+typedef unsigned char ScheduleRoleType;
+#define SCHEDULE_NONE          0 // Can't be levelized.
+#define SCHEDULE_COMBINATIONAL 1 // Outputs depend only on the inputs.
+#define SCHEDULE_STATE         2 // Clocked by its edge-triggered inputs.
+#define SCHEDULE_CLOCK         3 // A CLOCK gate.
+#define SCHEDULE_PASSIVE       4 // Has no outputs of its own(TO/FROM).
+
+// The type used for internal wire and gate and input IDs:
+// Note that we also don't worry about IDType running out of spaces, because an
+// unsigned long can memory reference the entire memory space anyhow. ,'o)
+//WARNING:(Unless of course, a loaded file gives you an ID that is near the
+// top of unsigned long's range to begin with!)
+typedef unsigned long IDType;
+
+// The ID that represents an unconnected wire or gate:
+#define ID_NONE ULONG_MAX
+
+// The type used for gate input and output pins. Each gate numbers its pins
+// from 0 in the order they are declared, so that the pin names only have to be
+// looked up once, and not every time an event is sent:
+typedef unsigned long PinType;
+
+// The pin that represents an undeclared pin:
+#define PIN_NONE ULONG_MAX
+
+// The type used to number the Circuit's event sources(the gate outputs and
+// junctions that events come from). It is kept small to keep events small:
+typedef unsigned int SourceType;
+
+// The event source that represents an unconnected gate output:
+#define SOURCE_NONE UINT_MAX
+
+// Pair-associative and associative containers for IDs:
+#define ID_MAP map
+#include<map>
+
+#define ID_SET set
+#include<set>
+
+#define EVENT_LIST vector
+#include<vector>
+
+#define WIRE_MAP map
+
+// Gate and wire pointer definitions:
+#include "counted_pointer.h"
+
+#define GATE_PTR counted_ptr< Gate >
+#define WIRE_PTR counted_ptr< Wire >
+#define JUNC_PTR counted_ptr< Junction >
+
+// Allow use of STL objects:
+#include <string>
+using namespace std;
+
+#endif // LOGIC_DEFAULTS_H
@@ -1,63 +1,60 @@
-/*****************************************************************************
-   Project: CEDAR Logic Simulator
-   Copyright 2006 Cedarville University, Benjamin Sprague,
-                     Matt Lewellyn, and David Knierim
-   All rights reserved.
-   For license information see license.txt included with distribution.   
-*****************************************************************************/
-
-// logic_event.h: interface for the Event class.
-// Ben Sprague, 10-15-2005
-//////////////////////////////////////////////////////////////////////
-
-#ifndef LOGIC_EVENT_H
-#define LOGIC_EVENT_H
-
-#include "logic_defaults.h"
-#include <ctime>
-
-// Events are simply scheduled wire input state changes. They are used
-// by the circuit and gates to store and activate state changes.
-
-class Event
-{
-public:
-// Junction event data:
-	bool isJunctionEvent;
-	bool newJunctionState;
-	IDType junctionID;
-
-// Wire event data:
-	StateType newState;  // The new state that will be caused by this event.
-	TimeType eventTime;  // The time at which the event will happen.
-	IDType wireID;       // The wire that the event will affect.
-	IDType gateID;       // The gate that is having a changed output.
-	string gateOutputID; // The gate output that is changing.
-
-	// Set default values for all data members:
-	Event() {
-		isJunctionEvent = false;
-		newJunctionState = false;
-		junctionID = ID_NONE;
-
-		newState = UNKNOWN;
-		eventTime = TIME_NONE;
-		wireID = ID_NONE;
-		gateID = ID_NONE;
-		gateOutputID = "";
-		
-		// Tag the creation time, for sorting if there are two at the same simulation time:
-		myCreationTime = globalCreationTime++;
-	};
-
-	unsigned long long getCreationTime(void) const {
-		return myCreationTime;
-	};
-
-private:
-	unsigned long long myCreationTime;
-	static unsigned long long globalCreationTime;
-};
-
-
-#endif // LOGIC_EVENT_H
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.   
+*****************************************************************************/
+
+// logic_event.h: interface for the Event class.
+// Ben Sprague, 10-15-2005
+//////////////////////////////////////////////////////////////////////
+
+#ifndef LOGIC_EVENT_H
+#define LOGIC_EVENT_H
+
+#include "logic_defaults.h"
+
+// Events are simply scheduled wire input state changes. They are used
+// by the circuit and gates to store and activate state changes.
+//(Besides wire events, there are junction events, which enable or disable a
+// junction, wake-up events, which call a gate's update at a time it asked
+// for - that is how CLOCK and PULSE gates run without being polled - and bus
+// events, which change all of the lines of a gate's output bus at once.)
+//
+// Events are copied around a lot by the event queue, so they are kept small
+// and plain(24 bytes, with no constructor or destructor). Instead of naming the
+// gate, gate output, wire or junction involved, an event names an "event source"
+// in the Circuit's table, which holds all of that.
+// The kinds of events:
+#define EVENT_WIRE 0
+#define EVENT_JUNCTION 1
+#define EVENT_WAKE_UP 2
+#define EVENT_BUS 3
+
+struct Event
+{
+	TimeType eventTime;          // The time at which the event will happen.
+	unsigned long long sequence; // The order the event was made in, for sorting events
+	                             // that happen at the same simulation time.
+	SourceType source;           // The gate output or junction sending the event.
+
+	unsigned char eventType;     // EVENT_WIRE, EVENT_JUNCTION, EVENT_WAKE_UP or EVENT_BUS.
+	StateType newState;          // The new state that a wire event will cause(or for a
+	                             // junction event, ONE to enable the junction and ZERO
+	                             // to disable it).
+	unsigned short busValue;     // For a bus event, where the new states of the bus lines
+	                             // are kept in the Circuit's table of bus event values.
+};
+
+// An operator to sort events by their event time. Used by the eventQueue;
+inline bool operator >(const Event &left, const Event &right) {
+	if(left.eventTime == right.eventTime) {
+		return(left.sequence > right.sequence);
+	} else {
+		return(left.eventTime > right.eventTime);
+	}
+}
+
+
+#endif // LOGIC_EVENT_H
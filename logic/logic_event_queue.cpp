@@ -0,0 +1,215 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_event_queue: The Circuit's queue of pending events
+*****************************************************************************/
+
+#include "logic_event_queue.h"
+
+#define WHEEL_MASK (EVENT_WHEEL_SIZE - 1)
+#define BITS_PER_WORD 64
+
+
+EventQueue::EventQueue()
+{
+	eventCount = 0;
+
+#ifndef EVENT_QUEUE_HEAP
+	wheel.resize(EVENT_WHEEL_SIZE);
+	occupied.resize(EVENT_WHEEL_SIZE / BITS_PER_WORD, 0);
+	wheelTime = 0;
+	wheelCount = 0;
+	firstSlot = EVENT_WHEEL_SIZE;
+#endif
+}
+
+EventQueue::~EventQueue()
+{
+}
+
+
+#ifdef EVENT_QUEUE_HEAP
+
+// Add an event to the queue:
+void EventQueue::push(const Event &newEvent) {
+	heapEvents.push_back(newEvent);
+	push_heap(heapEvents.begin(), heapEvents.end(), greater< Event >());
+	eventCount++;
+}
+
+// Look at the earliest event in the queue:
+const Event& EventQueue::top(void) {
+	return heapEvents.front();
+}
+
+// Remove the earliest event from the queue:
+void EventQueue::pop(void) {
+	pop_heap(heapEvents.begin(), heapEvents.end(), greater< Event >());
+	heapEvents.pop_back();
+	eventCount--;
+}
+
+// Throw away all of the events:
+void EventQueue::clear(void) {
+	heapEvents.clear();
+	eventCount = 0;
+}
+
+#else // EVENT_QUEUE_HEAP
+
+// Add an event to the queue:
+void EventQueue::push(const Event &newEvent) {
+	if(newEvent.eventTime < wheelTime) {
+		// The event belongs to a slot that the wheel has already passed:
+		lateEvents.push_back(newEvent);
+		push_heap(lateEvents.begin(), lateEvents.end(), greater< Event >());
+	} else if(newEvent.eventTime - wheelTime >= EVENT_WHEEL_SIZE) {
+		// Too far in the future to fit on the wheel yet:
+		farEvents.push_back(newEvent);
+		push_heap(farEvents.begin(), farEvents.end(), greater< Event >());
+	} else {
+		pushOnWheel(newEvent);
+	}
+	eventCount++;
+}
+
+
+// Look at the earliest event in the queue:
+const Event& EventQueue::top(void) {
+	// The late events are always earlier than anything on the wheel:
+	if(!lateEvents.empty()) {
+		return lateEvents.front();
+	}
+
+	// The wheel is always earlier than the overflow heap:
+	if(wheelCount > 0) {
+		if(firstSlot == EVENT_WHEEL_SIZE) firstSlot = findFirstSlot();
+		return wheel[firstSlot].events[wheel[firstSlot].head];
+	}
+
+	return farEvents.front();
+}
+
+
+// Remove the earliest event from the queue:
+void EventQueue::pop(void) {
+	eventCount--;
+
+	if(!lateEvents.empty()) {
+		pop_heap(lateEvents.begin(), lateEvents.end(), greater< Event >());
+		lateEvents.pop_back();
+		return;
+	}
+
+	// If the wheel has run dry, then jump it straight to the next
+	// overflow event:
+	if(wheelCount == 0) {
+		turnWheel(farEvents.front().eventTime);
+	}
+
+	if(firstSlot == EVENT_WHEEL_SIZE) firstSlot = findFirstSlot();
+	WheelSlot &slot = wheel[firstSlot];
+	TimeType slotTime = slot.events[slot.head].eventTime;
+
+	slot.head++;
+	wheelCount--;
+	if(slot.head == slot.events.size()) {
+		emptySlot(firstSlot);
+		firstSlot = EVENT_WHEEL_SIZE;
+	}
+
+	// Everything before this event is gone, so the wheel can move up to it:
+	if(slotTime != wheelTime) {
+		turnWheel(slotTime);
+	}
+}
+
+
+// Throw away all of the events:
+void EventQueue::clear(void) {
+	for(unsigned long i = 0; i < EVENT_WHEEL_SIZE; i++) {
+		if(!wheel[i].events.empty()) emptySlot(i);
+	}
+	lateEvents.clear();
+	farEvents.clear();
+	wheelCount = 0;
+	eventCount = 0;
+	firstSlot = EVENT_WHEEL_SIZE;
+}
+
+
+// Find the first non-empty slot of the wheel, starting at wheelTime:
+unsigned long EventQueue::findFirstSlot(void) {
+	unsigned long startSlot = wheelTime & WHEEL_MASK;
+	unsigned long numWords = EVENT_WHEEL_SIZE / BITS_PER_WORD;
+
+	// Check the bitmap one word at a time, wrapping around the wheel.
+	//(The first word is checked twice - once for the bits at and after
+	// startSlot and again at the end for the bits before it.)
+	for(unsigned long i = 0; i <= numWords; i++) {
+		unsigned long word = ((startSlot / BITS_PER_WORD) + i) % numWords;
+		unsigned long long bits = occupied[word];
+		if(i == 0) {
+			bits &= ~0ULL << (startSlot % BITS_PER_WORD);
+		}
+		if(bits != 0) {
+			unsigned long bit = 0;
+#ifdef __GNUC__
+			bit = __builtin_ctzll(bits);
+#else
+			while(!(bits & 1)) {
+				bits >>= 1;
+				bit++;
+			}
+#endif
+			return word * BITS_PER_WORD + bit;
+		}
+	}
+
+	return EVENT_WHEEL_SIZE;
+}
+
+
+// Mark a slot as empty, keeping its storage around for re-use:
+void EventQueue::emptySlot(unsigned long slot) {
+	wheel[slot].events.clear();
+	wheel[slot].head = 0;
+	occupied[slot / BITS_PER_WORD] &= ~(1ULL << (slot % BITS_PER_WORD));
+}
+
+
+// Move the wheel forward to newTime, pulling in the overflow events
+// that now fit on it:
+//(All slots before newTime must already be empty.)
+void EventQueue::turnWheel(TimeType newTime) {
+	wheelTime = newTime;
+
+	// The overflow heap hands the events back in time and creation order,
+	// so they land in their slots in the right order. No event can have been
+	// pushed directly into those slots yet, because they were out of range.
+	while(!farEvents.empty() && (farEvents.front().eventTime - wheelTime < EVENT_WHEEL_SIZE)) {
+		pushOnWheel(farEvents.front());
+		pop_heap(farEvents.begin(), farEvents.end(), greater< Event >());
+		farEvents.pop_back();
+	}
+}
+
+
+// Put an event that fits on the wheel into its slot:
+void EventQueue::pushOnWheel(const Event &newEvent) {
+	unsigned long slot = newEvent.eventTime & WHEEL_MASK;
+	wheel[slot].events.push_back(newEvent);
+	occupied[slot / BITS_PER_WORD] |= 1ULL << (slot % BITS_PER_WORD);
+	wheelCount++;
+
+	// Keep the cached first slot up to date:
+	if((firstSlot != EVENT_WHEEL_SIZE) && (newEvent.eventTime < wheel[firstSlot].events[wheel[firstSlot].head].eventTime)) {
+		firstSlot = slot;
+	}
+}
+
+#endif // EVENT_QUEUE_HEAP
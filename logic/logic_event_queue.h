@@ -0,0 +1,113 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_event_queue: The Circuit's queue of pending events
+*****************************************************************************/
+
+#ifndef LOGIC_EVENT_QUEUE_H_
+#define LOGIC_EVENT_QUEUE_H_
+
+#include "logic_defaults.h"
+#include "logic_event.h"
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+
+// If this is defined, the event queue is a plain binary heap (the way it
+// always used to be), otherwise it is a timing wheel. Leave it here so the
+// two can be benchmarked against each other:
+//#define EVENT_QUEUE_HEAP
+
+// The number of time slots in the timing wheel. Must be a power of 2.
+// Events further in the future than this are kept in an overflow heap
+// until the wheel turns far enough to reach them.
+#define EVENT_WHEEL_SIZE 1024
+
+// The event queue hands back events in the order given by
+// operator >(Event, Event): by event time, and by creation order
+// for events with the same time.
+//
+// The timing wheel keeps one FIFO bucket per time slot. Since events
+// are always pushed in creation order, each bucket is already sorted, so
+// inserting and extracting the earliest event are O(1) amortized. Events that
+// are scheduled in the past(e.g. by Gate::resendLastEvent()) go into a small
+// "late" heap that is always drained first.
+//
+// Events are never taken out of the middle of the queue. The Circuit cancels
+// events by marking them stale, and throws them away as they are popped.
+class EventQueue
+{
+public:
+	EventQueue();
+	virtual ~EventQueue();
+
+	// Add an event to the queue:
+	void push(const Event &newEvent);
+
+	// Look at the earliest event in the queue:
+	//(The queue must not be empty.)
+	const Event& top(void);
+
+	// Remove the earliest event from the queue:
+	void pop(void);
+
+	bool empty(void) const { return(eventCount == 0); };
+	unsigned long size(void) const { return eventCount; };
+
+	// Throw away all of the events:
+	void clear(void);
+
+private:
+	// The number of events in the queue:
+	unsigned long eventCount;
+
+#ifdef EVENT_QUEUE_HEAP
+	vector< Event > heapEvents;
+#else
+	// One slot of the timing wheel:
+	struct WheelSlot {
+		vector< Event > events;
+		unsigned long head; // The index of the first event not yet popped.
+		WheelSlot() : head(0) {};
+	};
+
+	// Find the first non-empty slot of the wheel, starting at wheelTime:
+	unsigned long findFirstSlot(void);
+
+	// Mark a slot as empty, keeping its storage around for re-use:
+	void emptySlot(unsigned long slot);
+
+	// Move the wheel forward to newTime, pulling in the overflow events
+	// that now fit on it:
+	void turnWheel(TimeType newTime);
+
+	// Put an event that fits on the wheel into its slot:
+	void pushOnWheel(const Event &newEvent);
+
+	vector< WheelSlot > wheel;
+
+	// One bit per slot, set if the slot has events in it:
+	vector< unsigned long long > occupied;
+
+	// The time of the earliest slot on the wheel. The wheel holds the events
+	// from wheelTime up to(but not including) wheelTime + EVENT_WHEEL_SIZE.
+	TimeType wheelTime;
+
+	// The number of events on the wheel itself:
+	unsigned long wheelCount;
+
+	// A cache of findFirstSlot(), or EVENT_WHEEL_SIZE if it is unknown:
+	unsigned long firstSlot;
+
+	// Heaps for the events before and after the wheel's window:
+	vector< Event > lateEvents;
+	vector< Event > farEvents;
+#endif
+};
+
+#endif /*LOGIC_EVENT_QUEUE_H_*/
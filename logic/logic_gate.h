@@ -1,781 +1,1214 @@
-/*****************************************************************************
-   Project: CEDAR Logic Simulator
-   Copyright 2006 Cedarville University, Benjamin Sprague,
-                     Matt Lewellyn, and David Knierim
-   All rights reserved.
-   For license information see license.txt included with distribution.   
-*****************************************************************************/
-
-// logic_gate.h: interface for the Gate class.
-//
-//////////////////////////////////////////////////////////////////////
-
-#ifndef LOGIC_GATE_H
-#define LOGIC_GATE_H
-
-#include "logic_defaults.h"
-#include "logic_event.h"
-#include "logic_wire.h"
-
-class Circuit;
-
-#include <string>
-#include <sstream>
-#include <assert.h>
-using namespace std;
-
-#if _MSC_VER > 1000
-#pragma once
-#endif // _MSC_VER > 1000
-
-struct GateInput {
-	IDType wireID;
-	bool inverted;
-	
-	GateInput() : wireID(ID_NONE), inverted(false) {};
-};
-
-struct GateOutput {
-	IDType wireID;
-	StateType lastEventState;
-	TimeType lastEventTime;
-	bool inverted;
-
-	string enableInput; // An input pin which is mapped as the enable pin for this output.
-
-	GateOutput() : wireID(ID_NONE), lastEventState(UNKNOWN), lastEventTime(TIME_NONE), inverted(false), enableInput("") {};
-};
-
-
-class Gate  
-{
-public:
-
-	// Update the gate's outputs:
-	void updateGate(IDType myID, Circuit * theCircuit);
-
-	// Resend the last event to a(probably newly connected) wire:	
-	void resendLastEvent(IDType myID, string outputID, Circuit * theCircuit);
-
-	// Set a gate parameter:
-	//(If the parameter change requires the gate to be updated to change its
-	// output state, then return "true".)
-	virtual bool setParameter(string paramName, string value);
-	virtual bool setInputParameter(string inputID, string paramName, string value);
-	virtual bool setOutputParameter(string outputID, string paramName, string value);
-
-	// Get the value of a gate parameter:
-	virtual string getParameter(string paramName);
-
-	// ********* Standard Gate mutator functions ************
-
-	// Connect a wire to the input of this gate:
-	virtual void connectInput(string inputID, IDType wireID);
-
-	// Connect a wire to the output of this gate:
-	virtual void connectOutput(string outputID, IDType wireID);
-
-	// Return the wire ID of a connected wire, or ID_NONE:
-	virtual IDType getInputWire(string inputID) {
-		return(inputList.find(inputID) == inputList.end()) ? ID_NONE : inputList[inputID].wireID;
-	};
-	virtual IDType getOutputWire(string outputID) {
-		return(outputList.find(outputID) == outputList.end()) ? ID_NONE : outputList[outputID].wireID;
-	};
-
-	// Disconnect a wire from the input of this gate:
-	//(Returns the wireID of the wire that was connected.)
-	virtual IDType disconnectInput(string inputID);
-
-	// Disconnect a wire from the output of this gate:
-	//(Returns the wireID of the wire that was connected.)
-	virtual IDType disconnectOutput(string outputID);
-
-	// Get the first input of the gate:
-	string getFirstConnectedInput(void);
-
-	// Get the first output of the gate that has a wire attached to it:
-	string getFirstConnectedOutput(void);
-
-	Gate();
-	virtual ~Gate();
-
-protected:
-	// Gate "Entity" declaration methods:
-
-	// Register an input for this gate:
-	// Possibly declare the input as edge triggered, which will cause it
-	// to be tracked to be able to check rising and falling edges.
-	void declareInput(string inputID, bool edgeTriggered = false);
-
-	// Return true if an input has been declared. False otherwise.
-	bool inputExists(string inputID) {
-		return(inputList.find(inputID) != inputList.end());
-	};
-
-	// Register a bus of inputs for this gate. They will be named
-	// "busName_0" through "busName_<busWidth-1>". They cannot be
-	// set as edge-triggered.
-	void declareInputBus(string busName, unsigned long busWidth) {
-		ostringstream oss;
-		for(unsigned long i = 0; i < busWidth; i++) {
-			oss.str("");
-			oss.clear();
-			oss << busName << "_" << i;
-			declareInput(oss.str());
-		}
-	};
-
-
-
-	// Register an output for this gate :
-	void declareOutput(string name);
-
-	// Return true if an input has been declared. False otherwise.
-	bool outputExists(string outputID) {
-		return(outputList.find(outputID) != outputList.end());
-	};
-
-	// Register a bus of outputs for this gate. They will be named
-	// "busName_0" through "busName_<busWidth-1>". They cannot be
-	// set as edge-triggered.
-	void declareOutputBus(string busName, unsigned long busWidth) {
-		ostringstream oss;
-		for(unsigned long i = 0; i < busWidth; i++) {
-			oss.str("");
-			oss.clear();
-			oss << busName << "_" << i;
-			declareOutput(oss.str());
-		}
-	};
-
-	// Set the input to be automatically inverted:
-	void  setInputInverted(string inputID, bool newInv = true) {
-		if(inputList.find(inputID) == inputList.end()) {
-			WARNING("Gate::setInputState() - Invalid input name.");
-			assert(false);
-			return;
-		}
-
-		// Set the inverted state:
-		this->inputList[inputID].inverted = newInv;
-	};
-
-
-	// Set the output to be automatically inverted:
-	void  setOutputInverted(string outputID, bool newInv = true) {
-		if(outputList.find(outputID) == outputList.end()) {
-			WARNING("Gate::setOutputState() - Invalid output name.");
-			assert(false);
-			return;
-		}
-
-		// Set the inverted state:
-		this->outputList[outputID].inverted = newInv;
-	};
-
-
-	// Set the output to be automatically inverted:
-	void  setOutputEnablePin(string outputID, string inputID) {
-		if(outputList.find(outputID) == outputList.end()) {
-			WARNING("Gate::setOutputEnablePin() - Invalid output name.");
-			assert(false);
-			return;
-		}
-
-		if(inputList.find(inputID) == inputList.end()) {
-			WARNING("Gate::setOutputEnablePin() - Invalid input name.");
-			assert(false);
-			return;
-		}
-
-		// Set the enable state:
-		this->outputList[outputID].enableInput = inputID;
-	};
-
-	// A helper function that allows you to convert a bus into a unsigned long:
-	//(HI_Z, etc. is interpreted as ZERO.)
-	unsigned long bus_to_ulong(vector< StateType > busStates);
-
-	// A helper function that allows you to convert an unsigned long number into a bus:
-	vector< StateType > ulong_to_bus(unsigned long number, unsigned long numBits);
-
-	// Gate "Process" activity methods:
-	// The process activity that this specific gate will perform. Note that
-	// class "Gate" must be subclassed and gateProcess() defined for a proper
-	// gate to be created.
-	virtual void gateProcess(void) = 0;
-	
-	// Get the current time in the simulation:
-	TimeType getSimTime(void);
-	
-	// Check the state of the named input and return it.
-	StateType getInputState(string name);
-	
-	// Get the input states of a bus of inputs named "busName_0" through
-	// "busName_x" and return their states as a vector.
-	vector< StateType > getInputBusState(string busName);
-
-	// Get the types of inputs that are represented.
-	vector< bool > groupInputStates(void);
-	
-	// Compare the "this" state with the "last" state and say if this is a rising or falling edge. 
-	bool isRisingEdge(string name); 
-	bool isFallingEdge(string name); 
-
-	// Send an output event to one of the outputs of this gate. 
-	// Compare the last sent event with the newState and decide whether or not to 
-	// really send the event. Also, log the last sent event so that it can be 
-	// repeated later if necessary. 
-	void setOutputState(string outID, StateType newState, TimeType delay = TIME_NONE);
-	
-	// Set the output states of a bus of outputs named "busName_0" through
-	// "busName_x" using a vector of states:
-	void setOutputBusState(string outID, vector< StateType > newState, TimeType delay = TIME_NONE);
-
-	// List a parameter in the Circuit as having been changed:
-	void listChangedParam(string paramName);
-
-protected:
-	// The default gate delay used for gates if
-	// not specified in the call to setOutputState:
-	TimeType defaultDelay;
-
-	// A mapping of gate input IDs to circuit wire IDs, to define
-	// the inputs into this gate, along with other input information:
-	ID_MAP< string, GateInput > inputList;
-
-	// A mapping of gate output IDs to circuit wire ID and wire input ID pairs, along
-	// with the storage of the "last state" information for the gate to avoid sending
-	// duplicate events:
-	ID_MAP< string, GateOutput > outputList;
-	
-	// Edge-triggered inputs and state data for them:
-	ID_SET< string > edgeTriggeredInputs;
-	ID_MAP< string, StateType > edgeTriggeredLastState;
-	
-	// A temporary pointer to the Circuit object, used for getting wire states, time info,
-	// and for sending events from gate outputs:
-	Circuit* ourCircuit;
-	
-	// A temporary ID used during updates, which represents this gate's ID in the Circuit.
-	IDType myID;
-	
-	//Edit by Joshua Lansford
-	//because we can not update paramiters
-	//when we are loading a file
-	//this flag is here so that we know we need to
-	//send and update next time we process
-	bool flushGuiMemory;
-	
-	
-	//This paramiter makes it so that we can
-	//send updates during non-gate processing
-	//calls.
-	//It makes flushGuiMemory obsolete, but
-	//it works, so I won't fix it.
-	vector<string> changedParamWaitingList;
-};
-
-
-// ******************* Gate_N_INPUT parent Gate *********************
-class Gate_N_INPUT : public Gate
-{
-public:
-	// Initialize the gate's interface:
-	Gate_N_INPUT();
-	
-	// Handle gate events:
-	void gateProcess(void) {};
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-
-	// Get the parameters:
-	string getParameter(string paramName);
-
-protected:
-	// The number of input bits:
-	unsigned long inBits;
-};
-
-
-// ******************* PASS Gate *********************
-//(It basically takes all inputs and passes them to the outputs.)
-class Gate_PASS : public Gate_N_INPUT
-{
-public:
-	// Initialize the gate's interface:
-	Gate_PASS();
-	
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-};
-
-
-// ******************* OR Gate *********************
-class Gate_OR : public Gate_N_INPUT
-{
-public:
-	// Initialize the gate's interface:
-	Gate_OR();
-	
-	// Handle gate events:
-	void gateProcess(void);
-};
-
-
-// ******************* AND Gate *********************
-class Gate_AND : public Gate_N_INPUT
-{
-public:
-	// Initialize the gate's interface:
-	Gate_AND();
-	
-	// Handle gate events:
-	void gateProcess(void);
-};
-
-// ****************** EQUIVALENCE Gate **************
-class Gate_EQUIVALENCE : public Gate_N_INPUT
-{
-public:
-	// Initialize the gate's interface:
-	Gate_EQUIVALENCE();
-	
-	// Handle gate events:
-	void gateProcess(void);
-};
-	
-
-// ******************* XOR Gate *********************
-class Gate_XOR : public Gate_N_INPUT
-{
-public:
-	// Initialize the gate's interface:
-	Gate_XOR();
-	
-	// Handle gate events:
-	void gateProcess(void);
-};
-
-
-// ******************* Register Gate *********************
-class Gate_REGISTER : public Gate_PASS
-{
-public:
-	Gate_REGISTER();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-
-	// Get the parameters:
-	string getParameter(string paramName);
-
-protected:
-	bool syncSet, syncClear, syncLoad, disableHold, unknownOutputs;
-
-	// The maximum count of this counter(maximum value).
-	//(BCD is 9, 4-bit binary is 15.)
-	unsigned long maxCount;
-
-	unsigned long currentValue;
-
-	// An initialization value, to make REGISTERs initialize more
-	// nicely when loading them or making new ones:
-	bool firstGateProcess;
-};
-
-
-// ******************* Clock Gate *********************
-class Gate_CLOCK : public Gate
-{
-public:
-	// Initialize the clock:
-	Gate_CLOCK(TimeType newHalfCycle = 0);
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the clock rate:
-	bool setParameter(string paramName, string value);
-
-	// Get the clock rate:
-	string getParameter(string paramName);
-
-private:
-	TimeType halfCycle;
-	StateType theState;
-};
-
-
-// ******************* Pulse Gate *********************
-class Gate_PULSE : public Gate
-{
-public:
-	// Initialize the clock:
-	Gate_PULSE();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the pulse:
-	bool setParameter(string paramName, string value);
-private:
-	TimeType pulseRemaining;
-};
-
-
-// ******************* Mux Gate *********************
-class Gate_MUX : public Gate_N_INPUT
-{
-public:
-	Gate_MUX();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-
-protected:
-	unsigned long selBits;
-};
-
-
-// ******************* Decoder Gate *********************
-class Gate_DECODER : public Gate_N_INPUT
-{
-public:
-	Gate_DECODER();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-
-protected:
-	unsigned long outBits;
-};
-
-
-// ******************* Driver Gate *********************
-// Can be used to drive a bus of n bits to a specific binary number.
-
-class Gate_DRIVER : public Gate
-{
-public:
-	// Initialize the driver gate:
-	Gate_DRIVER();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the current state:
-	bool setParameter(string paramName, string value);
-
-	// Get the current state:
-	string getParameter(string paramName);
-
-private:
-	unsigned long output_num;
-	unsigned long outBits;
-};
-
-
-// ******************* Full Adder Gate *********************
-// Performs an addition of two input busses. Assumes that unknown-type inputs are
-// all ZEROs.
-// NOTE: Will work with busses of up to 32-bits.
-
-class Gate_ADDER : public Gate_PASS
-{
-public:
-	// Initialize the gate's interface:
-	Gate_ADDER();
-	
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-};
-
-
-// ******************* Magnitude Comparator Gate *********************
-// Compares two input busses by magnitude.
-// Outputs "A==B", "A<B", "A>B" depending on results.
-// Has "A==B", "A<B", "A>B" inputs to allow cascading comparators.
-// "A==B" input defaults HIGH with an unknown input, but all others default LOW.
-
-class Gate_COMPARE : public Gate_N_INPUT
-{
-public:
-	// Initialize the gate's interface:
-	Gate_COMPARE();
-	
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-};
-
-
-// ******************* JK Flip Flop Gate *********************
-//NOTE: For all inputs, UNKNOWN states are interpreted as 0.
-
-class Gate_JKFF : public Gate
-{
-public:
-	// Initialize the gate's interface:
-	Gate_JKFF();
-	
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-
-	// Get the parameters:
-	string getParameter(string paramName);
-
-protected:
-	StateType currentState;
-	bool syncSet, syncClear;
-};
-
-
-// ***************** n-bit by n-bit RAM Gate *******************
-class Gate_RAM : public Gate
-{
-public:
-	// Initialize the ram:
-	Gate_RAM();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-
-	// Get the parameters:
-	string getParameter(string paramName);
-
-	// Write a file containing the memory data:
-	void outputMemoryFile(string fName);
-
-	// Read a file and load the memory data:
-	void inputMemoryFile(string fName);
-	
-//*************************************************
-//Edit by Joshua Lansford 1/22/06
-//This will make it so that the logic gate can
-//also load Intel Hex files.  This is a format
-//which is exported by the zad assembler.
-	void inputMemoryFileFromIntelHex(string fName);
-	
-	//a helper function
-	int readInHex(ifstream* fin, int numChars);
-//End of edit**************************************
-
-protected:
-	unsigned long dataBits;
-	unsigned long addressBits;
-
-	map< unsigned long, unsigned long > memory;
-	
-	//This is the last location that a read has
-	//taken place from.
-	unsigned long lastRead;
-};
-
-
-// ******************* Junction Gate *********************
-// This class uses the circuit's Junctioning capabilities
-// to enable and disable a junction and splice the inputs
-// into the junction, to allow true to/from nodes.
-class Gate_JUNCTION : public Gate
-{
-public:
-	// Initialize the junction gate:
-	// Note: Because this gate does some really funky stuff,
-	// it needs a pointer to the circuit to manipulate the Junction
-	// objects.
-	Gate_JUNCTION(Circuit *newCircuit);
-
-	// Remove this junction's claim on the junction ID:
-	~Gate_JUNCTION();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the junction's ID:
-	bool setParameter(string paramName, string value);
-
-	// Get the junction's ID:
-	string getParameter(string paramName);
-
-	// Connect a wire to the input of this gate:
-	void connectInput(string inputID, IDType wireID);
-
-	// Disconnect a wire from the input of this gate:
-	//(Returns the wireID of the wire that was connected.)
-	IDType disconnectInput(string inputID);
-
-private:
-	string myID;
-	Circuit * myCircuit;
-
-	// All the wires hooked up to this particular junction gate:
-	//(Needs the counted wire deal in case you hook up a wire twice,
-	// and then unhook it once. We don't want to remove it from the set yet then.)
-	ID_SET< IDType > myWires;
-	ID_MAP< IDType, unsigned long > myWireCounts;
-
-	// The shared junction IDs and usage counters:
-//	static ID_MAP< string, IDType > junctionIDs;
-//	static ID_MAP< string, unsigned long > junctionUseCounter;
-};
-
-
-// ******************* T Gate *********************
-// This class uses the circuit's Junctioning capabilities
-// to enable and disable a junction and splice the inputs
-// into the junction, to allow T-gates.
-// Note: All of the connections are INPUTS!(That way, they default to HI_Z.)
-// Input 0 = T-Gate input
-// Input 1 = T-Gate input2/output
-// Input 2 = Control input
-
-class Gate_T : public Gate
-{
-public:
-	// Initialize the gate:
-	// Note: Because this gate does some really funky stuff,
-	// it needs a pointer to the circuit to manipulate the Junction
-	// objects.
-	Gate_T(Circuit *newCircuit);
-	
-	// Destroy the gate, and remove the Junction object from the
-	// Circuit:
-	~Gate_T();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Connect a wire to the input of this gate:
-	void connectInput(string inputID, IDType wireID);
-
-	// Disconnect a wire from the input of this gate:
-	//(Returns the wireID of the wire that was connected.)
-	IDType disconnectInput(string inputID);
-
-private:
-	Circuit * myCircuit;
-
-	// The junctionID of the junction that this t-gate controls:
-	IDType junctionID;
-
-	// The last state of the junction:
-	bool juncLastState;
-};
-
-
-// ******************* NODE Gate *********************
-// This class uses the circuit's Junctioning capabilities
-// to splice the inputs into the junction, to allow nodes.
-// Note: All of the connections are INPUTS!(That way, they default to HI_Z.)
-// Input 0-7 = NODE gate input/output
-
-class Gate_NODE : public Gate
-{
-public:
-	// Initialize the gate:
-	// Note: Because this gate does some really funky stuff,
-	// it needs a pointer to the circuit to manipulate the Junction
-	// objects.
-	Gate_NODE(Circuit *newCircuit);
-	
-	// Destroy the gate, and remove the Junction object from the
-	// Circuit:
-	~Gate_NODE();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Connect a wire to the input of this gate:
-	void connectInput(string inputID, IDType wireID);
-
-	// Disconnect a wire from the input of this gate:
-	//(Returns the wireID of the wire that was connected.)
-	IDType disconnectInput(string inputID);
-
-private:
-	Circuit * myCircuit;
-
-	// The junctionID of the junction that this t-gate controls:
-	IDType junctionID;
-};
-
-//********************************
-//Edit by Joshua Lansford 5/10/07
-//The following is a faked ADC.
-//It is fake because there is no
-//analog input to the chip.
-//The input is provided by a slider
-//in a popup
-//********************************
-class Gate_ADC : public Gate
-{
-public:
-	// Initialize the adc:
-	Gate_ADC();
-
-	// Handle gate events:
-	void gateProcess(void);
-
-	// Set the parameters:
-	bool setParameter(string paramName, string value);
-
-	// Get the parameters:
-	string getParameter(string paramName);
-
-protected:
-	unsigned long analogValue;
-	unsigned long digitalValue;
-	int countDown;
-	bool interuptIsFlaged;
-};
-
-//***************************************************************
-//Edit by Joshua Lansford 6/5/2007
-//This edit is to create a new gate called the pauseulator.
-//This gate has one input and no outputs.  When the input of this
-//gate goes high, then it will pause the simulation.  This takes
-//avantage of the pauseing hooks that I had to create for the Z80.
-class Gate_pauseulator : public Gate
-{
-public:
-	Gate_pauseulator();
-	
-	
-	void gateProcess(void);
-
-	bool setParameter(string paramName, string value);
-
-	string getParameter(string paramName);
-};
-//End of edit****************************************************
-
-
-
-
-#endif // LOGIC_GATE_H
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.   
+*****************************************************************************/
+
+// logic_gate.h: interface for the Gate class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#ifndef LOGIC_GATE_H
+#define LOGIC_GATE_H
+
+#include "logic_defaults.h"
+#include "logic_event.h"
+#include "logic_wire.h"
+
+class Circuit;
+
+#include <string>
+#include <sstream>
+#include <assert.h>
+using namespace std;
+
+#if _MSC_VER > 1000
+#pragma once
+#endif // _MSC_VER > 1000
+
+// The state read from an input that isn't connected to a wire:
+extern const StateType unconnectedInputState;
+
+// The number of independent simulations("vectors") that a VectorSimulator
+// runs at once, one per bit of a LaneWord:
+#define VECTOR_LANES 64
+typedef unsigned long long LaneWord;
+
+// The states of one line in each of the VECTOR_LANES vectors, packed into bit
+// planes: bit i of each word is vector i. A lane has at most one of its bits
+// set, which says whether it is ZERO, ONE, UNKNOWN or CONFLICT, and a lane with
+// none of them set is HI_Z. This lets gates work out all of the vectors at once
+// with word operations:
+struct VectorState {
+	LaneWord zero;
+	LaneWord one;
+	LaneWord unknown;
+	LaneWord conflict;
+
+	VectorState(LaneWord zero = 0, LaneWord one = 0, LaneWord unknown = 0, LaneWord conflict = 0) :
+		zero(zero), one(one), unknown(unknown), conflict(conflict) {};
+
+	// The lanes that are ONE or ZERO:
+	LaneWord known(void) const { return zero | one; };
+
+	// Return the state of one lane:
+	StateType getLane(unsigned long lane) const {
+		if((one >> lane) & 1) return ONE;
+		if((zero >> lane) & 1) return ZERO;
+		if((unknown >> lane) & 1) return UNKNOWN;
+		return((conflict >> lane) & 1) ? CONFLICT : HI_Z;
+	};
+};
+
+// The vector states read from an input that isn't connected to a wire:
+extern const VectorState unconnectedInputVector;
+
+struct GateInput {
+	string name;
+	IDType wireID;
+	bool inverted;
+
+	// Where to read the state of the input's wire from. The Circuit points
+	// this straight at the wire's state when it compiles the connectivity,
+	// and it points at unconnectedInputState while there's no wire:
+	const StateType *wireState;
+
+	// Where to read the input's vector states from, while a VectorSimulator
+	// is running the gate:
+	const VectorState *vectorState;
+
+	// Edge-triggered inputs keep their state from the last update, to be
+	// able to check for rising and falling edges:
+	bool edgeTriggered;
+	bool hasLastState;
+	StateType lastState;
+	
+	GateInput() : name(""), wireID(ID_NONE), inverted(false), wireState(&unconnectedInputState), vectorState(&unconnectedInputVector), edgeTriggered(false), hasLastState(false), lastState(UNKNOWN) {};
+};
+
+// The number of bus lines that fit in one word of a BusPlanes:
+#define BUS_PLANE_BITS (sizeof(unsigned long) * 8)
+
+// Return a mask of the low numBits bits of a word(all of them if
+// numBits is BUS_PLANE_BITS or more):
+inline unsigned long busMask(unsigned long numBits) {
+	return(numBits >= BUS_PLANE_BITS) ? ~0UL : ((1UL << numBits) - 1);
+}
+
+// Return bit i of a word(false for bits past the end of the word):
+inline bool busBit(unsigned long word, unsigned long i) {
+	return(i < BUS_PLANE_BITS) && ((word >> i) & 1);
+}
+
+// The states of a bus, packed into bit planes: bit i of each word is line i
+// of the bus. A line is ONE if its bit is set in "ones", UNKNOWN(or CONFLICT,
+// when reading) if it is set in "unknown", HI_Z if it is set in "hiZ", and
+// ZERO otherwise. Only the first BUS_PLANE_BITS lines fit in the planes; the
+// rest read and write as ZERO, the same as bus_to_ulong() and ulong_to_bus().
+// This lets the bus gates work on a whole bus with word operations instead
+// of vectors of states:
+struct BusPlanes {
+	unsigned long width; // The number of lines in the bus.
+	unsigned long ones;
+	unsigned long unknown;
+	unsigned long hiZ;
+
+	BusPlanes(unsigned long width = 0, unsigned long ones = 0, unsigned long unknown = 0, unsigned long hiZ = 0) :
+		width(width), ones(ones), unknown(unknown), hiZ(hiZ) {};
+
+	// Return the state of line i:
+	StateType getLine(unsigned long i) const {
+		if(busBit(hiZ, i)) return HI_Z;
+		if(busBit(unknown, i)) return UNKNOWN;
+		return busBit(ones, i) ? ONE : ZERO;
+	};
+};
+
+struct GateOutput {
+	string name;
+	IDType wireID;
+	StateType lastEventState;
+	TimeType lastEventTime;
+	bool inverted;
+
+	PinType enableInput; // An input pin which is mapped as the enable pin for this output.
+
+	SourceType eventSource; // The Circuit's event source for this output, while it is connected.
+
+	unsigned long outputBus; // The gate's output bus that this output is a line of, while
+	                         // the bus is connected to a bus wire(ID_NONE otherwise).
+
+	VectorState *vectorState; // Where a VectorSimulator takes the output's vector states
+	                          // from(NULL when the output isn't being simulated).
+
+	GateOutput() : name(""), wireID(ID_NONE), lastEventState(UNKNOWN), lastEventTime(TIME_NONE), inverted(false), enableInput(PIN_NONE), eventSource(SOURCE_NONE), outputBus(ID_NONE), vectorState(NULL) {};
+};
+
+// An output bus of a gate that is connected to a bus wire as a whole. Changes
+// to its lines that are made together are sent as a single bus event:
+struct GateOutputBus {
+	vector< PinType > pins;
+	SourceType eventSource; // SOURCE_NONE once the bus has been disconnected.
+
+	GateOutputBus() : eventSource(SOURCE_NONE) {};
+};
+
+// A call that a gate makes to the Circuit while it is being updated(an
+// event, a bus event or a parameter change), held back so that the Circuit
+// can make it later. The Circuit updates gates on several threads at once
+// this way, and then makes their calls in the same order as if it had
+// updated them one at a time:
+#define GATE_CALL_EVENT     0
+#define GATE_CALL_BUS_EVENT 1
+#define GATE_CALL_PARAM     2
+
+struct GateCall {
+	unsigned char callType;
+	TimeType eventTime;
+	unsigned long outputPin; // The output pin, or the output bus for a bus event.
+	StateType newState;
+	BusPlanes busState;
+	unsigned long changedLines;
+	string paramName;
+};
+
+
+class Gate  
+{
+friend class Circuit;
+friend class VectorSimulator;
+friend class PartitionEngine;
+public:
+
+	// Update the gate's outputs:
+	//(atTime is the simulation time to update the gate at, if it isn't the
+	// Circuit's own systemTime.)
+	void updateGate(IDType myID, Circuit * theCircuit, TimeType atTime = TIME_NONE);
+
+	// Resend the last event to a(probably newly connected) wire:	
+	void resendLastEvent(IDType myID, PinType outputPin, Circuit * theCircuit);
+
+	// Return the next time, at or after "now", at which a self-scheduling gate
+	// (like CLOCK or PULSE) needs to be updated, or TIME_NONE if it has nothing
+	// more to do by itself. The Circuit asks after each update of the gate and
+	// puts a wake-up event in the queue for that time. Other gates only update
+	// when their inputs change:
+	virtual TimeType getWakeUpTime(TimeType now) { return TIME_NONE; };
+
+	// Can the gate be run by a VectorSimulator? Only combinational gates that
+	// define gateProcessVectors() can be:
+	virtual bool canProcessVectors(void) { return false; };
+
+	// Work out the gate's outputs for all of the VectorSimulator's vectors at
+	// once, like gateProcess() does for one, with getInputVector() and
+	// setOutputVector():
+	virtual void gateProcessVectors(void) {};
+
+	// How the Circuit's levelized engine can treat the gate(SCHEDULE_NONE if
+	// it can't, which makes the Circuit fall back to the event engine):
+	virtual ScheduleRoleType getScheduleRole(void) { return SCHEDULE_NONE; };
+
+	// Can the gate be updated on another thread, alongside other gates? Gates
+	// that do more to the Circuit than send events and parameter changes
+	// (like TO/FROM and T gates) can't, and the Circuit updates them by
+	// themselves:
+	virtual bool canUpdateInParallel(void) { return true; };
+
+	// Set a gate parameter:
+	//(If the parameter change requires the gate to be updated to change its
+	// output state, then return "true".)
+	virtual bool setParameter(string paramName, string value);
+	virtual bool setInputParameter(string inputID, string paramName, string value);
+	virtual bool setOutputParameter(string outputID, string paramName, string value);
+
+	// Get the value of a gate parameter:
+	virtual string getParameter(string paramName);
+
+	// ********* Standard Gate mutator functions ************
+
+	// Connect a wire to the input of this gate:
+	virtual void connectInput(string inputID, IDType wireID);
+
+	// Connect a wire to the output of this gate:
+	virtual void connectOutput(string outputID, IDType wireID);
+
+	// Return the wire ID of a connected wire, or ID_NONE:
+	virtual IDType getInputWire(string inputID) {
+		PinType inputPin = findInput(inputID);
+		return(inputPin == PIN_NONE) ? ID_NONE : inputList[inputPin].wireID;
+	};
+	virtual IDType getOutputWire(string outputID) {
+		PinType outputPin = findOutput(outputID);
+		return(outputPin == PIN_NONE) ? ID_NONE : outputList[outputPin].wireID;
+	};
+
+	// Return the pin number of a named input or output, or PIN_NONE if
+	// it hasn't been declared:
+	PinType findInput(string inputID) {
+		ID_MAP< string, PinType >::iterator thePin = inputNames.find(inputID);
+		return(thePin == inputNames.end()) ? PIN_NONE : thePin->second;
+	};
+	PinType findOutput(string outputID) {
+		ID_MAP< string, PinType >::iterator thePin = outputNames.find(outputID);
+		return(thePin == outputNames.end()) ? PIN_NONE : thePin->second;
+	};
+
+	// Return the gate's delay mode, which may be DELAY_DEFAULT:
+	DelayModeType getDelayMode(void) { return delayMode; };
+
+	// Get and set the Circuit's event source for an output pin:
+	SourceType getOutputSource(PinType outputPin) {
+		return(outputPin < outputList.size()) ? outputList[outputPin].eventSource : SOURCE_NONE;
+	};
+	void setOutputSource(PinType outputPin, SourceType source) {
+		if(outputPin < outputList.size()) outputList[outputPin].eventSource = source;
+	};
+
+	// Get and set the Circuit's event source for the gate's wake-up events:
+	//(SOURCE_NONE unless the gate is self-scheduling.)
+	SourceType getWakeUpSource(void) { return wakeUpSource; };
+	void setWakeUpSource(SourceType source) { wakeUpSource = source; };
+
+	// Return the name of an input or output pin:
+	string getInputName(PinType inputPin) {
+		return(inputPin < inputList.size()) ? inputList[inputPin].name : "";
+	};
+	string getOutputName(PinType outputPin) {
+		return(outputPin < outputList.size()) ? outputList[outputPin].name : "";
+	};
+
+	// Disconnect a wire from the input of this gate:
+	//(Returns the wireID of the wire that was connected.)
+	virtual IDType disconnectInput(string inputID);
+
+	// Disconnect a wire from the output of this gate:
+	//(Returns the wireID of the wire that was connected.)
+	virtual IDType disconnectOutput(string outputID);
+
+	// Get the first input of the gate:
+	string getFirstConnectedInput(void);
+
+	// Get the first output of the gate that has a wire attached to it:
+	string getFirstConnectedOutput(void);
+
+	Gate();
+	virtual ~Gate();
+
+protected:
+	// Gate "Entity" declaration methods:
+
+	// Register an input for this gate, and return its pin number:
+	// Possibly declare the input as edge triggered, which will cause it
+	// to be tracked to be able to check rising and falling edges.
+	PinType declareInput(string inputID, bool edgeTriggered = false);
+
+	// Return true if an input has been declared. False otherwise.
+	bool inputExists(string inputID) {
+		return(inputNames.find(inputID) != inputNames.end());
+	};
+
+	// Register a bus of inputs for this gate. They will be named
+	// "busName_0" through "busName_<busWidth-1>". They cannot be
+	// set as edge-triggered. Returns the pin numbers of the bus.
+	vector< PinType > declareInputBus(string busName, unsigned long busWidth) {
+		vector< PinType > busPins;
+		ostringstream oss;
+		for(unsigned long i = 0; i < busWidth; i++) {
+			oss.str("");
+			oss.clear();
+			oss << busName << "_" << i;
+			busPins.push_back(declareInput(oss.str()));
+		}
+		return busPins;
+	};
+
+	// Return the pin numbers of the inputs "busName_0" through "busName_x",
+	// as far as they have been declared:
+	vector< PinType > findInputBus(string busName);
+
+
+
+	// Register an output for this gate, and return its pin number:
+	PinType declareOutput(string name);
+
+	// Return true if an input has been declared. False otherwise.
+	bool outputExists(string outputID) {
+		return(outputNames.find(outputID) != outputNames.end());
+	};
+
+	// Register a bus of outputs for this gate. They will be named
+	// "busName_0" through "busName_<busWidth-1>". They cannot be
+	// set as edge-triggered. Returns the pin numbers of the bus.
+	vector< PinType > declareOutputBus(string busName, unsigned long busWidth) {
+		vector< PinType > busPins;
+		ostringstream oss;
+		for(unsigned long i = 0; i < busWidth; i++) {
+			oss.str("");
+			oss.clear();
+			oss << busName << "_" << i;
+			busPins.push_back(declareOutput(oss.str()));
+		}
+		return busPins;
+	};
+
+	// Return the pin numbers of the outputs "busName_0" through "busName_x",
+	// as far as they have been declared:
+	vector< PinType > findOutputBus(string busName);
+
+	// Set the input to be automatically inverted:
+	void  setInputInverted(string inputID, bool newInv = true) {
+		PinType inputPin = findInput(inputID);
+		if(inputPin == PIN_NONE) {
+			WARNING("Gate::setInputState() - Invalid input name.");
+			assert(false);
+			return;
+		}
+
+		// Set the inverted state:
+		this->inputList[inputPin].inverted = newInv;
+	};
+
+
+	// Set the output to be automatically inverted:
+	void  setOutputInverted(string outputID, bool newInv = true) {
+		PinType outputPin = findOutput(outputID);
+		if(outputPin == PIN_NONE) {
+			WARNING("Gate::setOutputState() - Invalid output name.");
+			assert(false);
+			return;
+		}
+
+		// Set the inverted state:
+		this->outputList[outputPin].inverted = newInv;
+	};
+
+
+	// Set the output to be automatically inverted:
+	void  setOutputEnablePin(string outputID, string inputID) {
+		PinType outputPin = findOutput(outputID);
+		if(outputPin == PIN_NONE) {
+			WARNING("Gate::setOutputEnablePin() - Invalid output name.");
+			assert(false);
+			return;
+		}
+
+		PinType inputPin = findInput(inputID);
+		if(inputPin == PIN_NONE) {
+			WARNING("Gate::setOutputEnablePin() - Invalid input name.");
+			assert(false);
+			return;
+		}
+
+		// Set the enable state:
+		this->outputList[outputPin].enableInput = inputPin;
+	};
+
+	// A helper function that allows you to convert a bus into a unsigned long:
+	//(HI_Z, etc. is interpreted as ZERO.)
+	unsigned long bus_to_ulong(vector< StateType > busStates);
+
+	// A helper function that allows you to convert an unsigned long number into a bus:
+	vector< StateType > ulong_to_bus(unsigned long number, unsigned long numBits);
+
+	// Read a bus of input pins into bit planes, without building a vector of
+	// its states:
+	BusPlanes getInputBusPlanes(const vector< PinType > &busPins);
+
+	// Read a bus of input pins as a number, like bus_to_ulong(getInputBusState()):
+	//(HI_Z, etc. is interpreted as ZERO.)
+	unsigned long getInputBusNumber(const vector< PinType > &busPins) {
+		return getInputBusPlanes(busPins).ones;
+	};
+
+	// Set the output states of a bus of output pins from bit planes:
+	//(newState.width lines are set, like the vector form of setOutputBusState().)
+	void setOutputBusPlanes(const vector< PinType > &busPins, const BusPlanes &newState, TimeType delay = TIME_NONE);
+
+	// Set the first numBits lines of a bus of output pins to a number, like
+	// setOutputBusState(busPins, ulong_to_bus(number, numBits)):
+	void setOutputBusNumber(const vector< PinType > &busPins, unsigned long number, unsigned long numBits, TimeType delay = TIME_NONE) {
+		setOutputBusPlanes(busPins, BusPlanes(numBits, number), delay);
+	};
+
+	// Set the first numBits lines of a bus of output pins to HI_Z:
+	void setOutputBusHI_Z(const vector< PinType > &busPins, unsigned long numBits, TimeType delay = TIME_NONE);
+
+	// Gate "Process" activity methods:
+	// The process activity that this specific gate will perform. Note that
+	// class "Gate" must be subclassed and gateProcess() defined for a proper
+	// gate to be created.
+	virtual void gateProcess(void) = 0;
+	
+	// Get the current time in the simulation:
+	TimeType getSimTime(void);
+	
+	// Check the state of an input and return it.
+	StateType getInputState(PinType inputPin);
+	StateType getInputState(string name) {
+		return getInputState(findInput(name));
+	};
+	
+	// Get the input states of a bus of inputs named "busName_0" through
+	// "busName_x"(or of the given input pins) and return their states as a vector.
+	vector< StateType > getInputBusState(const vector< PinType > &busPins);
+	vector< StateType > getInputBusState(string busName) {
+		return getInputBusState(findInputBus(busName));
+	};
+
+	// Get the types of inputs that are represented.
+	vector< bool > groupInputStates(void);
+	
+	// Compare the "this" state with the "last" state and say if this is a rising or falling edge. 
+	bool isRisingEdge(PinType inputPin); 
+	bool isFallingEdge(PinType inputPin); 
+	bool isRisingEdge(string name) {
+		return isRisingEdge(findInput(name));
+	};
+	bool isFallingEdge(string name) {
+		return isFallingEdge(findInput(name));
+	};
+
+	// Send an output event to one of the outputs of this gate. 
+	// Compare the last sent event with the newState and decide whether or not to 
+	// really send the event. Also, log the last sent event so that it can be 
+	// repeated later if necessary. 
+	void setOutputState(PinType outputPin, StateType newState, TimeType delay = TIME_NONE);
+	void setOutputState(string outID, StateType newState, TimeType delay = TIME_NONE) {
+		setOutputState(findOutput(outID), newState, delay);
+	};
+	
+	// Set the output states of a bus of outputs named "busName_0" through
+	// "busName_x"(or of the given output pins) using a vector of states:
+	void setOutputBusState(const vector< PinType > &busPins, const vector< StateType > &newState, TimeType delay = TIME_NONE);
+	void setOutputBusState(string outID, const vector< StateType > &newState, TimeType delay = TIME_NONE) {
+		setOutputBusState(findOutputBus(outID), newState, delay);
+	};
+
+	// List a parameter in the Circuit as having been changed:
+	void listChangedParam(string paramName);
+
+	// Get the vector states of an input, for gateProcessVectors():
+	VectorState getInputVector(PinType inputPin);
+
+	// Set the vector states of an output, for gateProcessVectors():
+	void setOutputVector(PinType outputPin, const VectorState &newState);
+
+private:
+	// Work out the state that an output will really send when it is set to
+	// newState, after its inversion and enable pin are applied:
+	StateType getOutputEventState(const GateOutput &theOutput, StateType newState);
+
+	// Set the lines of an output bus that is connected to a bus wire, with a
+	// single bus event for all of the lines that change:
+	void setConnectedOutputBus(unsigned long busIndex, const BusPlanes &newState, TimeType delay);
+
+protected:
+	// The default gate delay used for gates if
+	// not specified in the call to setOutputState:
+	TimeType defaultDelay;
+
+	// The gate's delay mode(DELAY_TRANSPORT or DELAY_INERTIAL), or
+	// DELAY_DEFAULT to go along with the Circuit's setting:
+	DelayModeType delayMode;
+
+	// The Circuit's event source for the gate's wake-up events:
+	SourceType wakeUpSource;
+
+	// The last step that put this gate in the Circuit's list of gates
+	// to update:
+	unsigned long long stepMark;
+
+	// The number of times the gate has been updated(see
+	// Circuit::getGateUpdateCount()):
+	unsigned long long updateCount;
+
+	// The gate's type, as an index into Circuit::getGateTypeNames():
+	unsigned long typeIndex;
+
+	// The updates and the seconds spent in them while the Circuit's gate
+	// profiler was on(see Circuit::setProfiling()):
+	unsigned long long profileCalls;
+	double profileSeconds;
+
+	// The gate's index in the Circuit's compiled connectivity, and where
+	// its row of input wires starts there:
+	IDType compiledIndex;
+	unsigned long firstInputSlot;
+
+	// The gate's inputs, indexed by pin number, holding the circuit wire IDs
+	// that define the inputs into this gate, along with other input information:
+	vector< GateInput > inputList;
+
+	// The gate's outputs, indexed by pin number, holding the circuit wire IDs along
+	// with the storage of the "last state" information for the gate to avoid sending
+	// duplicate events:
+	vector< GateOutput > outputList;
+
+	// The gate's output buses that are connected to bus wires, indexed by
+	// GateOutput::outputBus:
+	vector< GateOutputBus > outputBuses;
+
+	// The mappings of input and output names to pin numbers:
+	ID_MAP< string, PinType > inputNames;
+	ID_MAP< string, PinType > outputNames;
+	
+	// The pin numbers of the edge-triggered inputs:
+	vector< PinType > edgeTriggeredInputs;
+	
+	// A temporary pointer to the Circuit object, used for getting wire states, time info,
+	// and for sending events from gate outputs:
+	Circuit* ourCircuit;
+
+	// Where to hold the calls to the Circuit back, while the gate is being
+	// updated on another thread(NULL to make them straight away):
+	vector< GateCall > *heldCalls;
+
+	// The simulation time of the current update:
+	TimeType updateTime;
+	
+	// A temporary ID used during updates, which represents this gate's ID in the Circuit.
+	IDType myID;
+	
+	//Edit by Joshua Lansford
+	//because we can not update paramiters
+	//when we are loading a file
+	//this flag is here so that we know we need to
+	//send and update next time we process
+	bool flushGuiMemory;
+	
+	
+	//This paramiter makes it so that we can
+	//send updates during non-gate processing
+	//calls.
+	//It makes flushGuiMemory obsolete, but
+	//it works, so I won't fix it.
+	vector<string> changedParamWaitingList;
+};
+
+
+// ******************* Gate_N_INPUT parent Gate *********************
+class Gate_N_INPUT : public Gate
+{
+public:
+	// Initialize the gate's interface:
+	Gate_N_INPUT();
+	
+	// Handle gate events:
+	void gateProcess(void) {};
+
+	// The N-input gates are all combinational, apart from the REGISTER:
+	ScheduleRoleType getScheduleRole(void) { return SCHEDULE_COMBINATIONAL; };
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+	// Get the parameters:
+	string getParameter(string paramName);
+
+protected:
+	// The number of input bits:
+	unsigned long inBits;
+
+	// The "IN" input pins:
+	vector< PinType > inPins;
+};
+
+
+// ******************* PASS Gate *********************
+//(It basically takes all inputs and passes them to the outputs.)
+class Gate_PASS : public Gate_N_INPUT
+{
+public:
+	// Initialize the gate's interface:
+	Gate_PASS();
+	
+	// Handle gate events:
+	void gateProcess(void);
+	void gateProcessVectors(void);
+	bool canProcessVectors(void) { return true; };
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+protected:
+	// The "OUT" output pins:
+	vector< PinType > outPins;
+};
+
+
+// ******************* OR Gate *********************
+class Gate_OR : public Gate_N_INPUT
+{
+public:
+	// Initialize the gate's interface:
+	Gate_OR();
+	
+	// Handle gate events:
+	void gateProcess(void);
+	void gateProcessVectors(void);
+	bool canProcessVectors(void) { return true; };
+
+private:
+	PinType outPin;
+};
+
+
+// ******************* AND Gate *********************
+class Gate_AND : public Gate_N_INPUT
+{
+public:
+	// Initialize the gate's interface:
+	Gate_AND();
+	
+	// Handle gate events:
+	void gateProcess(void);
+	void gateProcessVectors(void);
+	bool canProcessVectors(void) { return true; };
+
+private:
+	PinType outPin;
+};
+
+// ****************** EQUIVALENCE Gate **************
+class Gate_EQUIVALENCE : public Gate_N_INPUT
+{
+public:
+	// Initialize the gate's interface:
+	Gate_EQUIVALENCE();
+	
+	// Handle gate events:
+	void gateProcess(void);
+	void gateProcessVectors(void);
+	bool canProcessVectors(void) { return true; };
+
+private:
+	PinType outPin;
+};
+	
+
+// ******************* XOR Gate *********************
+class Gate_XOR : public Gate_N_INPUT
+{
+public:
+	// Initialize the gate's interface:
+	Gate_XOR();
+	
+	// Handle gate events:
+	void gateProcess(void);
+	void gateProcessVectors(void);
+	bool canProcessVectors(void) { return true; };
+
+private:
+	PinType outPin;
+};
+
+
+// ******************* Register Gate *********************
+class Gate_REGISTER : public Gate_PASS
+{
+public:
+	Gate_REGISTER();
+
+	// Handle gate events:
+	void gateProcess(void);
+
+	// Unlike the PASS gate, this gate can't be run by a VectorSimulator, and
+	// it is a state element:
+	bool canProcessVectors(void) { return false; };
+	ScheduleRoleType getScheduleRole(void) { return SCHEDULE_STATE; };
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+	// Get the parameters:
+	string getParameter(string paramName);
+
+protected:
+	bool syncSet, syncClear, syncLoad, disableHold, unknownOutputs;
+
+	// The maximum count of this counter(maximum value).
+	//(BCD is 9, 4-bit binary is 15.)
+	unsigned long maxCount;
+
+	unsigned long currentValue;
+
+	// An initialization value, to make REGISTERs initialize more
+	// nicely when loading them or making new ones:
+	bool firstGateProcess;
+
+	// The control pins:
+	PinType clockPin, clockEnablePin, clearPin, setPin, loadPin;
+	PinType countEnablePin, countUpPin, shiftEnablePin, shiftLeftPin, carryInPin;
+	PinType carryOutPin;
+
+	// The "OUTINV" output pins:
+	vector< PinType > outInvPins;
+};
+
+
+// ******************* Clock Gate *********************
+class Gate_CLOCK : public Gate
+{
+public:
+	// Initialize the clock:
+	Gate_CLOCK(TimeType newHalfCycle = 0);
+
+	// Handle gate events:
+	void gateProcess(void);
+
+	// Set the clock rate:
+	bool setParameter(string paramName, string value);
+
+	// Get the clock rate:
+	string getParameter(string paramName);
+
+	// The clock only changes state on multiples of halfCycle:
+	TimeType getWakeUpTime(TimeType now);
+
+	ScheduleRoleType getScheduleRole(void) { return SCHEDULE_CLOCK; };
+
+private:
+	TimeType halfCycle;
+	StateType theState;
+	PinType clkPin;
+
+	// Set once the clock has driven its output for the first time:
+	bool stateSent;
+};
+
+
+// ******************* Pulse Gate *********************
+class Gate_PULSE : public Gate
+{
+public:
+	// Initialize the clock:
+	Gate_PULSE();
+
+	// Handle gate events:
+	void gateProcess(void);
+
+	// Set the pulse:
+	bool setParameter(string paramName, string value);
+
+	// The pulse only needs waking up while it is running:
+	TimeType getWakeUpTime(TimeType now);
+private:
+	TimeType pulseRemaining;
+	PinType outPin;
+
+	// Set once the output has been driven back to ZERO after a pulse:
+	bool pulseDone;
+};
+
+
+// ******************* Mux Gate *********************
+class Gate_MUX : public Gate_N_INPUT
+{
+public:
+	Gate_MUX();
+
+	// Handle gate events:
+	void gateProcess(void);
+	void gateProcessVectors(void);
+	bool canProcessVectors(void) { return true; };
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+protected:
+	unsigned long selBits;
+
+	// The "SEL" input pins and the output pin:
+	vector< PinType > selPins;
+	PinType outPin;
+};
+
+
+// ******************* Decoder Gate *********************
+class Gate_DECODER : public Gate_N_INPUT
+{
+public:
+	Gate_DECODER();
+
+	// Handle gate events:
+	void gateProcess(void);
+	void gateProcessVectors(void);
+	bool canProcessVectors(void) { return true; };
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+protected:
+	unsigned long outBits;
+
+	// The enable pins and the "OUT" output pins:
+	PinType enablePin, enableBPin, enableCPin;
+	vector< PinType > outPins;
+};
+
+
+// ******************* Driver Gate *********************
+// Can be used to drive a bus of n bits to a specific binary number.
+
+class Gate_DRIVER : public Gate
+{
+public:
+	// Initialize the driver gate:
+	Gate_DRIVER();
+
+	// Handle gate events:
+	void gateProcess(void);
+
+	ScheduleRoleType getScheduleRole(void) { return SCHEDULE_COMBINATIONAL; };
+
+	// Set the current state:
+	bool setParameter(string paramName, string value);
+
+	// Get the current state:
+	string getParameter(string paramName);
+
+private:
+	unsigned long output_num;
+	unsigned long outBits;
+
+	// The "OUT" output pins:
+	vector< PinType > outPins;
+};
+
+
+// ******************* Full Adder Gate *********************
+// Performs an addition of two input busses. Assumes that unknown-type inputs are
+// all ZEROs.
+// NOTE: Will work with busses of up to 32-bits.
+
+class Gate_ADDER : public Gate_PASS
+{
+public:
+	// Initialize the gate's interface:
+	Gate_ADDER();
+	
+	// Handle gate events:
+	void gateProcess(void);
+
+	// Unlike the PASS gate, this gate can't be run by a VectorSimulator:
+	bool canProcessVectors(void) { return false; };
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+private:
+	// The "IN_B" input pins, and the carry pins:
+	vector< PinType > inBPins;
+	PinType carryInPin, carryOutPin, overflowPin;
+};
+
+
+// ******************* Magnitude Comparator Gate *********************
+// Compares two input busses by magnitude.
+// Outputs "A==B", "A<B", "A>B" depending on results.
+// Has "A==B", "A<B", "A>B" inputs to allow cascading comparators.
+// "A==B" input defaults HIGH with an unknown input, but all others default LOW.
+
+class Gate_COMPARE : public Gate_N_INPUT
+{
+public:
+	// Initialize the gate's interface:
+	Gate_COMPARE();
+	
+	// Handle gate events:
+	void gateProcess(void);
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+private:
+	// The "IN_B" input pins, and the cascading inputs and the outputs:
+	vector< PinType > inBPins;
+	PinType inEqualPin, inGreaterPin, inLessPin;
+	PinType equalPin, greaterPin, lessPin;
+};
+
+
+// ******************* JK Flip Flop Gate *********************
+//NOTE: For all inputs, UNKNOWN states are interpreted as 0.
+
+class Gate_JKFF : public Gate
+{
+public:
+	// Initialize the gate's interface:
+	Gate_JKFF();
+	
+	// Handle gate events:
+	void gateProcess(void);
+
+	ScheduleRoleType getScheduleRole(void) { return SCHEDULE_STATE; };
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+	// Get the parameters:
+	string getParameter(string paramName);
+
+protected:
+	StateType currentState;
+	bool syncSet, syncClear;
+
+	PinType clockPin, jPin, kPin, setPin, clearPin;
+	PinType qPin, nqPin;
+};
+
+
+// ***************** n-bit by n-bit RAM Gate *******************
+class Gate_RAM : public Gate
+{
+public:
+	// Initialize the ram:
+	Gate_RAM();
+
+	// Handle gate events:
+	void gateProcess(void);
+
+	// The gate writes to the log when it is written to:
+	bool canUpdateInParallel(void) { return false; };
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+	// Get the parameters:
+	string getParameter(string paramName);
+
+	// Write a file containing the memory data:
+	void outputMemoryFile(string fName);
+
+	// Read a file and load the memory data:
+	void inputMemoryFile(string fName);
+	
+//*************************************************
+//Edit by Joshua Lansford 1/22/06
+//This will make it so that the logic gate can
+//also load Intel Hex files.  This is a format
+//which is exported by the zad assembler.
+	void inputMemoryFileFromIntelHex(string fName);
+	
+	//a helper function
+	int readInHex(ifstream* fin, int numChars);
+//End of edit**************************************
+
+protected:
+	unsigned long dataBits;
+	unsigned long addressBits;
+
+	map< unsigned long, unsigned long > memory;
+	
+	//This is the last location that a read has
+	//taken place from.
+	unsigned long lastRead;
+
+	PinType writeClockPin, writeEnablePin, enable0Pin;
+	vector< PinType > addressPins, dataInPins, dataOutPins;
+};
+
+
+// ******************* Junction Gate *********************
+// This class uses the circuit's Junctioning capabilities
+// to enable and disable a junction and splice the inputs
+// into the junction, to allow true to/from nodes.
+class Gate_JUNCTION : public Gate
+{
+public:
+	// Initialize the junction gate:
+	// Note: Because this gate does some really funky stuff,
+	// it needs a pointer to the circuit to manipulate the Junction
+	// objects.
+	Gate_JUNCTION(Circuit *newCircuit);
+
+	// Remove this junction's claim on the junction ID:
+	~Gate_JUNCTION();
+
+	// Handle gate events:
+	void gateProcess(void);
+
+	// The junction does the work, so there is nothing to schedule:
+	ScheduleRoleType getScheduleRole(void) { return SCHEDULE_PASSIVE; };
+
+	// The junction gates change the Circuit's junctions:
+	bool canUpdateInParallel(void) { return false; };
+
+	// Set the junction's ID:
+	bool setParameter(string paramName, string value);
+
+	// Get the junction's ID:
+	string getParameter(string paramName);
+
+	// Connect a wire to the input of this gate:
+	void connectInput(string inputID, IDType wireID);
+
+	// Disconnect a wire from the input of this gate:
+	//(Returns the wireID of the wire that was connected.)
+	IDType disconnectInput(string inputID);
+
+private:
+	string myID;
+	Circuit * myCircuit;
+
+	// All the wires hooked up to this particular junction gate:
+	//(Needs the counted wire deal in case you hook up a wire twice,
+	// and then unhook it once. We don't want to remove it from the set yet then.)
+	ID_SET< IDType > myWires;
+	ID_MAP< IDType, unsigned long > myWireCounts;
+
+	// The shared junction IDs and usage counters:
+//	static ID_MAP< string, IDType > junctionIDs;
+//	static ID_MAP< string, unsigned long > junctionUseCounter;
+};
+
+
+// ******************* T Gate *********************
+// This class uses the circuit's Junctioning capabilities
+// to enable and disable a junction and splice the inputs
+// into the junction, to allow T-gates.
+// Note: All of the connections are INPUTS!(That way, they default to HI_Z.)
+// Input 0 = T-Gate input
+// Input 1 = T-Gate input2/output
+// Input 2 = Control input
+
+class Gate_T : public Gate
+{
+public:
+	// Initialize the gate:
+	// Note: Because this gate does some really funky stuff,
+	// it needs a pointer to the circuit to manipulate the Junction
+	// objects.
+	Gate_T(Circuit *newCircuit);
+	
+	// Destroy the gate, and remove the Junction object from the
+	// Circuit:
+	~Gate_T();
+
+	// Handle gate events:
+	void gateProcess(void);
+
+	// The gate changes the Circuit's junctions:
+	bool canUpdateInParallel(void) { return false; };
+
+	// Connect a wire to the input of this gate:
+	void connectInput(string inputID, IDType wireID);
+
+	// Disconnect a wire from the input of this gate:
+	//(Returns the wireID of the wire that was connected.)
+	IDType disconnectInput(string inputID);
+
+private:
+	Circuit * myCircuit;
+
+	// The junctionID of the junction that this t-gate controls:
+	IDType junctionID;
+
+	// The last state of the junction:
+	bool juncLastState;
+
+	PinType ctrlPin;
+};
+
+
+// ******************* NODE Gate *********************
+// This class uses the circuit's Junctioning capabilities
+// to splice the inputs into the junction, to allow nodes.
+// Note: All of the connections are INPUTS!(That way, they default to HI_Z.)
+// Input 0-7 = NODE gate input/output
+
+class Gate_NODE : public Gate
+{
+public:
+	// Initialize the gate:
+	// Note: Because this gate does some really funky stuff,
+	// it needs a pointer to the circuit to manipulate the Junction
+	// objects.
+	Gate_NODE(Circuit *newCircuit);
+	
+	// Destroy the gate, and remove the Junction object from the
+	// Circuit:
+	~Gate_NODE();
+
+	// Handle gate events:
+	void gateProcess(void);
+
+	// The gate changes the Circuit's junctions:
+	bool canUpdateInParallel(void) { return false; };
+
+	// Connect a wire to the input of this gate:
+	void connectInput(string inputID, IDType wireID);
+
+	// Disconnect a wire from the input of this gate:
+	//(Returns the wireID of the wire that was connected.)
+	IDType disconnectInput(string inputID);
+
+private:
+	Circuit * myCircuit;
+
+	// The junctionID of the junction that this t-gate controls:
+	IDType junctionID;
+};
+
+//********************************
+//Edit by Joshua Lansford 5/10/07
+//The following is a faked ADC.
+//It is fake because there is no
+//analog input to the chip.
+//The input is provided by a slider
+//in a popup
+//********************************
+class Gate_ADC : public Gate
+{
+public:
+	// Initialize the adc:
+	Gate_ADC();
+
+	// Handle gate events:
+	void gateProcess(void);
+
+	// Set the parameters:
+	bool setParameter(string paramName, string value);
+
+	// Get the parameters:
+	string getParameter(string paramName);
+
+protected:
+	unsigned long analogValue;
+	unsigned long digitalValue;
+	int countDown;
+	bool interuptIsFlaged;
+
+	PinType clockPin, csPin, wrPin, rdPin, intPin;
+	vector< PinType > outPins;
+};
+
+//***************************************************************
+//Edit by Joshua Lansford 6/5/2007
+//This edit is to create a new gate called the pauseulator.
+//This gate has one input and no outputs.  When the input of this
+//gate goes high, then it will pause the simulation.  This takes
+//avantage of the pauseing hooks that I had to create for the Z80.
+class Gate_pauseulator : public Gate
+{
+public:
+	Gate_pauseulator();
+	
+	
+	void gateProcess(void);
+
+	bool setParameter(string paramName, string value);
+
+	string getParameter(string paramName);
+
+private:
+	PinType signalPin;
+};
+//End of edit****************************************************
+
+
+
+
+#endif // LOGIC_GATE_H
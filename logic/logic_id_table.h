@@ -0,0 +1,157 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_id_table: ID-indexed storage for the Circuit's gates, wires
+   and junctions
+*****************************************************************************/
+
+#ifndef LOGIC_ID_TABLE_H_
+#define LOGIC_ID_TABLE_H_
+
+#include "logic_defaults.h"
+
+#include <vector>
+#include <algorithm>
+
+// How far past the end of the dense table a new ID may be and still be
+// stored in it. IDs further out than this(from a loaded file, for instance)
+// go into the sparse map until the dense table grows up to them:
+#define ID_TABLE_SLACK 1024
+
+// The dense table is also grown to take in the IDs in the sparse map once
+// it would have no more than this many slots per object(plus the slack),
+// so that a table whose IDs all start far from 0 still ends up dense:
+#define ID_TABLE_FILL 8
+
+// A table of objects indexed by ID.
+//
+// The IDs handed out by the Circuit come from counters that start at 0,
+// so they are stored directly in a vector, and looking one up is just an
+// index. The rare IDs that are too far past the end of the vector to be
+// worth growing it for are kept in a map instead, until there are enough
+// objects to fill the vector out to them(see ID_TABLE_FILL).
+//
+// get() hands back a plain pointer so that the simulation loops don't have
+// to touch the reference counts. The pointer is only good until the object
+// is erased from the table.
+template < class T > class IDTable
+{
+public:
+	IDTable() : itemCount(0) {};
+
+	// Does the table have an object with this ID?
+	bool exists(IDType id) const {
+		return(get(id) != NULL);
+	};
+
+	// Get the object with this ID, or NULL if there isn't one:
+	T* get(IDType id) const {
+		if(id < dense.size()) return dense[id].get();
+		if(sparse.empty()) return NULL;
+
+		typename ID_MAP< IDType, counted_ptr< T > >::const_iterator found = sparse.find(id);
+		return (found == sparse.end()) ? NULL : found->second.get();
+	};
+
+	// Get a counted pointer to the object with this ID, or an empty one
+	// if there isn't one:
+	counted_ptr< T > getPtr(IDType id) const {
+		if(id < dense.size()) return dense[id];
+
+		typename ID_MAP< IDType, counted_ptr< T > >::const_iterator found = sparse.find(id);
+		return (found == sparse.end()) ? counted_ptr< T >() : found->second;
+	};
+
+	// Put an object in the table, replacing any object with the same ID:
+	void insert(IDType id, const counted_ptr< T > &item) {
+		if(!exists(id)) itemCount++;
+
+		// Take in all of the sparse objects if there are enough objects to
+		// fill the dense table out to them, or else just this one if it is
+		// close enough to the end:
+		IDType top = sparse.empty() ? id : max(id, sparse.rbegin()->first);
+		if(top >= dense.size()) {
+			if(fillsTo(top)) {
+				grow(top);
+			} else if((id >= dense.size()) && (fillsTo(id) || (id - dense.size() < dense.size() + ID_TABLE_SLACK))) {
+				grow(id);
+			}
+		}
+
+		if(id < dense.size()) {
+			dense[id] = item;
+		} else {
+			sparse[id] = item;
+		}
+	};
+
+	// Remove an object from the table:
+	void erase(IDType id) {
+		if(!exists(id)) return;
+		itemCount--;
+
+		if(id < dense.size()) {
+			dense[id] = counted_ptr< T >();
+		} else {
+			sparse.erase(id);
+		}
+	};
+
+	// Remove all of the objects from the table:
+	void clear(void) {
+		dense.clear();
+		sparse.clear();
+		itemCount = 0;
+	};
+
+	unsigned long size(void) const { return itemCount; };
+
+	// Get the IDs of all of the objects in the table:
+	ID_SET< IDType > getIDs(void) const {
+		ID_SET< IDType > idList;
+		for(IDType id = 0; id < dense.size(); id++) {
+			if(dense[id].get() != NULL) idList.insert(idList.end(), id);
+		}
+		typename ID_MAP< IDType, counted_ptr< T > >::const_iterator thisItem = sparse.begin();
+		while(thisItem != sparse.end()) {
+			idList.insert(idList.end(), thisItem->first);
+			thisItem++;
+		}
+		return idList;
+	};
+
+private:
+	// Are there enough objects to fill the dense table out to id?
+	bool fillsTo(IDType id) const {
+		return(id < (IDType) itemCount * ID_TABLE_FILL + ID_TABLE_SLACK);
+	};
+
+	// Grow the dense table so that it holds id, and move any sparse
+	// objects that now fit into it:
+	void grow(IDType id) {
+		IDType newSize = dense.size() * 2;
+		if(newSize <= id) newSize = id + 1;
+		dense.resize(newSize);
+
+		while(!sparse.empty() && (sparse.begin()->first < newSize)) {
+			dense[sparse.begin()->first] = sparse.begin()->second;
+			sparse.erase(sparse.begin());
+		}
+	};
+
+	// The objects with IDs 0 to dense.size() - 1, with empty pointers
+	// for the unused IDs:
+	vector< counted_ptr< T > > dense;
+
+	// The objects with IDs past the end of the dense table:
+	ID_MAP< IDType, counted_ptr< T > > sparse;
+
+	// The number of objects in the table:
+	unsigned long itemCount;
+};
+
+#endif /*LOGIC_ID_TABLE_H_*/
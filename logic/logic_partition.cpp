@@ -0,0 +1,774 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_partition: Runs the Circuit's event simulation split up into
+   partitions, each on its own thread
+*****************************************************************************/
+
+#include "logic_partition.h"
+#include "logic_circuit.h"
+
+#include <algorithm>
+#include <deque>
+
+
+// The number of passes made over the gates to move them into better
+// partitions, once they have been grown into partitions:
+#define PARTITION_REFINE_PASSES 2
+
+
+PartitionEngine::PartitionEngine(Circuit* newCircuit)
+{
+	theCircuit = newCircuit;
+	numPartitions = 0;
+	cutWireCount = 0;
+	lookahead = TIME_NONE;
+}
+
+
+PartitionEngine::~PartitionEngine()
+{
+}
+
+
+// Find the cluster that a wire is in, for compile():
+static unsigned long findCluster(vector< unsigned long > &cluster, unsigned long wire) {
+	while(cluster[wire] != wire) {
+		cluster[wire] = cluster[cluster[wire]];
+		wire = cluster[wire];
+	}
+	return wire;
+}
+
+
+// Cut the circuit into numPartitions partitions:
+void PartitionEngine::compile(unsigned long newPartitionCount) {
+	Circuit* c = theCircuit;
+	numPartitions = (newPartitionCount < 1) ? 1 : newPartitionCount;
+	unsigned long numGates = c->compiledGates.size();
+	unsigned long numWires = c->compiledWires.size();
+	unsigned long numGroups = c->junctionGroups.size();
+
+	// Put the wires into clusters that have to stay together: the wires that
+	// share a junction(enabled or not, since it can be enabled later), and
+	// the wires that are in the same junction group:
+	vector< unsigned long > cluster(numWires);
+	for(unsigned long i = 0; i < numWires; i++) cluster[i] = i;
+
+	ID_SET< IDType > juncIDs = c->juncList.getIDs();
+	ID_SET< IDType >::iterator thisJunc = juncIDs.begin();
+	while(thisJunc != juncIDs.end()) {
+		const multiset< IDType > &juncWires = c->juncList.get(*thisJunc)->getWireList();
+		unsigned long firstWire = ID_NONE;
+		multiset< IDType >::const_iterator thisWire = juncWires.begin();
+		while(thisWire != juncWires.end()) {
+			Wire* myWire = c->wireList.get(*thisWire);
+			if(myWire != NULL) {
+				if(firstWire == ID_NONE) {
+					firstWire = findCluster(cluster, myWire->compiledIndex);
+				} else {
+					cluster[findCluster(cluster, myWire->compiledIndex)] = firstWire;
+				}
+			}
+			thisWire++;
+		}
+		thisJunc++;
+	}
+	for(unsigned long i = 0; i < numGroups; i++) {
+		vector< IDType > &groupWires = c->junctionGroups[i].wires;
+		for(unsigned long j = 1; j < groupWires.size(); j++) {
+			unsigned long first = findCluster(cluster, c->wireList.get(groupWires[0])->compiledIndex);
+			cluster[findCluster(cluster, c->wireList.get(groupWires[j])->compiledIndex)] = first;
+		}
+	}
+	for(unsigned long i = 0; i < numWires; i++) findCluster(cluster, i);
+
+	// Find the stimulus gates, and list the clusters that each of the other
+	// gates is connected to(gate g's are gateClusters[gateClusterStart[g] ..
+	// gateClusterStart[g + 1] - 1]):
+	gatePartition.assign(numGates, ID_NONE);
+	stimulusGates.clear();
+	vector< bool > isStimulus(numGates, false);
+	vector< unsigned long > gateClusterStart(numGates + 1, 0);
+	vector< unsigned long > gateClusters;
+	vector< unsigned long > theseClusters;
+	unsigned long numRealGates = 0;
+	for(unsigned long g = 0; g < numGates; g++) {
+		gateClusterStart[g] = gateClusters.size();
+		Gate* myGate = c->compiledGates[g];
+
+		theseClusters.clear();
+		for(unsigned long i = 0; i < myGate->inputList.size(); i++) {
+			IDType wireIndex = c->gateInputWires[myGate->firstInputSlot + i];
+			if(wireIndex != ID_NONE) theseClusters.push_back(cluster[wireIndex]);
+		}
+
+		if(theseClusters.empty() && (myGate->getWakeUpSource() != SOURCE_NONE)) {
+			isStimulus[g] = true;
+			stimulusGates.push_back(g);
+			continue;
+		}
+		numRealGates++;
+
+		for(unsigned long i = 0; i < myGate->outputList.size(); i++) {
+			Wire* myWire = c->wireList.get(myGate->outputList[i].wireID);
+			if(myWire != NULL) theseClusters.push_back(cluster[myWire->compiledIndex]);
+		}
+		sort(theseClusters.begin(), theseClusters.end());
+		theseClusters.erase(unique(theseClusters.begin(), theseClusters.end()), theseClusters.end());
+		gateClusters.insert(gateClusters.end(), theseClusters.begin(), theseClusters.end());
+	}
+	gateClusterStart[numGates] = gateClusters.size();
+
+	// And the gates connected to each cluster, the same way:
+	vector< unsigned long > clusterGateStart(numWires + 1, 0);
+	vector< IDType > clusterGates(gateClusters.size());
+	for(unsigned long i = 0; i < gateClusters.size(); i++) clusterGateStart[gateClusters[i] + 1]++;
+	for(unsigned long i = 0; i < numWires; i++) clusterGateStart[i + 1] += clusterGateStart[i];
+	vector< unsigned long > clusterFill(clusterGateStart.begin(), clusterGateStart.end() - 1);
+	for(unsigned long g = 0; g < numGates; g++) {
+		for(unsigned long i = gateClusterStart[g]; i < gateClusterStart[g + 1]; i++) {
+			clusterGates[clusterFill[gateClusters[i]]++] = g;
+		}
+	}
+
+	// Grow the partitions one at a time, breadth first along the wires from
+	// the lowest-numbered gate that isn't in a partition yet, until each one
+	// has its share of the gates:
+	unsigned long target = (numRealGates + numPartitions - 1) / numPartitions;
+	vector< unsigned long > partSize(numPartitions, 0);
+	vector< unsigned long > clusterVisit(numWires, ID_NONE);
+	deque< IDType > frontier;
+	unsigned long nextSeed = 0;
+	for(unsigned long k = 0; k < numPartitions; k++) {
+		unsigned long wanted = (k + 1 == numPartitions) ? numRealGates : target;
+		frontier.clear();
+		while(partSize[k] < wanted) {
+			if(frontier.empty()) {
+				while((nextSeed < numGates) && (isStimulus[nextSeed] || (gatePartition[nextSeed] != ID_NONE))) nextSeed++;
+				if(nextSeed >= numGates) break;
+				gatePartition[nextSeed] = k;
+				partSize[k]++;
+				frontier.push_back(nextSeed);
+				continue;
+			}
+
+			IDType g = frontier.front();
+			frontier.pop_front();
+			for(unsigned long i = gateClusterStart[g]; (i < gateClusterStart[g + 1]) && (partSize[k] < wanted); i++) {
+				unsigned long myCluster = gateClusters[i];
+				if(clusterVisit[myCluster] == k) continue;
+				clusterVisit[myCluster] = k;
+				for(unsigned long j = clusterGateStart[myCluster]; (j < clusterGateStart[myCluster + 1]) && (partSize[k] < wanted); j++) {
+					IDType otherGate = clusterGates[j];
+					if(gatePartition[otherGate] != ID_NONE) continue;
+					gatePartition[otherGate] = k;
+					partSize[k]++;
+					frontier.push_back(otherGate);
+				}
+			}
+		}
+	}
+
+	// Move gates to other partitions where that cuts fewer clusters, as long
+	// as the partitions stay about the same size. pins[cluster * numPartitions + k]
+	// is the number of partition k's gates that are connected to the cluster:
+	vector< unsigned long > pins(numWires * numPartitions, 0);
+	for(unsigned long g = 0; g < numGates; g++) {
+		if(isStimulus[g]) continue;
+		for(unsigned long i = gateClusterStart[g]; i < gateClusterStart[g + 1]; i++) {
+			pins[gateClusters[i] * numPartitions + gatePartition[g]]++;
+		}
+	}
+	unsigned long maxSize = target + target / 32 + 1;
+	vector< unsigned long > candidates;
+	for(unsigned long pass = 0; pass < PARTITION_REFINE_PASSES; pass++) {
+		bool moved = false;
+		for(unsigned long g = 0; g < numGates; g++) {
+			if(isStimulus[g]) continue;
+			unsigned long from = gatePartition[g];
+
+			// The clusters that the gate would stop cutting by leaving:
+			long leaveGain = 0;
+			candidates.clear();
+			for(unsigned long i = gateClusterStart[g]; i < gateClusterStart[g + 1]; i++) {
+				unsigned long *clusterPins = &pins[gateClusters[i] * numPartitions];
+				if(clusterPins[from] == 1) leaveGain++;
+				for(unsigned long k = 0; k < numPartitions; k++) {
+					if((k != from) && (clusterPins[k] > 0)) candidates.push_back(k);
+				}
+			}
+			if(leaveGain == 0) continue;
+			sort(candidates.begin(), candidates.end());
+			candidates.erase(unique(candidates.begin(), candidates.end()), candidates.end());
+
+			// Less the clusters that it would start cutting in its new partition:
+			unsigned long bestPart = from;
+			long bestGain = 0;
+			for(unsigned long j = 0; j < candidates.size(); j++) {
+				unsigned long to = candidates[j];
+				if(partSize[to] >= maxSize) continue;
+				long gain = leaveGain;
+				for(unsigned long i = gateClusterStart[g]; i < gateClusterStart[g + 1]; i++) {
+					if(pins[gateClusters[i] * numPartitions + to] == 0) gain--;
+				}
+				if(gain > bestGain) {
+					bestGain = gain;
+					bestPart = to;
+				}
+			}
+			if(bestPart == from) continue;
+
+			for(unsigned long i = gateClusterStart[g]; i < gateClusterStart[g + 1]; i++) {
+				pins[gateClusters[i] * numPartitions + from]--;
+				pins[gateClusters[i] * numPartitions + bestPart]++;
+			}
+			partSize[from]--;
+			partSize[bestPart]++;
+			gatePartition[g] = bestPart;
+			moved = true;
+		}
+		if(!moved) break;
+	}
+
+	// Each cluster(and so each junction group) belongs to the partition with
+	// the most gates connected to it:
+	vector< unsigned long > clusterOwner(numWires, 0);
+	for(unsigned long i = 0; i < numWires; i++) {
+		if(cluster[i] != i) continue;
+		unsigned long *clusterPins = &pins[i * numPartitions];
+		for(unsigned long k = 1; k < numPartitions; k++) {
+			if(clusterPins[k] > clusterPins[clusterOwner[i]]) clusterOwner[i] = k;
+		}
+	}
+	groupOwner.assign(numGroups, 0);
+	for(unsigned long i = 0; i < numGroups; i++) {
+		vector< IDType > &groupWires = c->junctionGroups[i].wires;
+		if(groupWires.empty()) continue;
+		groupOwner[i] = clusterOwner[cluster[c->wireList.get(groupWires[0])->compiledIndex]];
+	}
+
+	// Give each partition ghosts of the wires its gates read from the other
+	// partitions:
+	partitions.clear();
+	partitions.resize(numPartitions);
+	for(unsigned long k = 0; k < numPartitions; k++) {
+		partitions[k].groupGhosts.assign(numGroups, ID_NONE);
+	}
+	for(unsigned long g = 0; g < numGates; g++) {
+		if(isStimulus[g]) continue;
+		Partition &thePart = partitions[gatePartition[g]];
+		Gate* myGate = c->compiledGates[g];
+		for(PinType i = 0; i < myGate->inputList.size(); i++) {
+			IDType wireIndex = c->gateInputWires[myGate->firstInputSlot + i];
+			if(wireIndex == ID_NONE) continue;
+			IDType groupID = c->compiledWires[wireIndex]->junctionGroup;
+			if(groupOwner[groupID] == gatePartition[g]) continue;
+
+			unsigned long ghostIndex = thePart.groupGhosts[groupID];
+			if(ghostIndex == ID_NONE) {
+				ghostIndex = thePart.ghosts.size();
+				thePart.groupGhosts[groupID] = ghostIndex;
+				thePart.ghosts.push_back(Ghost());
+				thePart.ghosts[ghostIndex].groupID = groupID;
+			}
+			vector< IDType > &readers = thePart.ghosts[ghostIndex].readers;
+			if(readers.empty() || (readers.back() != g)) readers.push_back(g);
+
+			GhostInput newInput;
+			newInput.gate = myGate;
+			newInput.inputPin = i;
+			newInput.ghost = ghostIndex;
+			thePart.ghostInputs.push_back(newInput);
+		}
+	}
+
+	// List the partitions with ghosts of each group, and count the cut groups
+	// (those with ghosts, or with drivers in another partition):
+	groupGhostStart.assign(numGroups + 1, 0);
+	groupGhostParts.clear();
+	vector< bool > isCut(numGroups, false);
+	for(unsigned long i = 0; i < numGroups; i++) {
+		groupGhostStart[i] = groupGhostParts.size();
+		for(unsigned long k = 0; k < numPartitions; k++) {
+			if(partitions[k].groupGhosts[i] != ID_NONE) {
+				groupGhostParts.push_back(k);
+				isCut[i] = true;
+			}
+		}
+	}
+	groupGhostStart[numGroups] = groupGhostParts.size();
+	for(unsigned long g = 0; g < numGates; g++) {
+		if(isStimulus[g]) continue;
+		Gate* myGate = c->compiledGates[g];
+		for(unsigned long i = 0; i < myGate->outputList.size(); i++) {
+			Wire* myWire = c->wireList.get(myGate->outputList[i].wireID);
+			if((myWire != NULL) && (groupOwner[myWire->junctionGroup] != gatePartition[g])) {
+				isCut[myWire->junctionGroup] = true;
+			}
+		}
+	}
+	cutWireCount = count(isCut.begin(), isCut.end(), true);
+}
+
+
+// Can the circuit be run partitioned? Also works out the lookahead:
+bool PartitionEngine::canRun(void) {
+	Circuit* c = theCircuit;
+	if((numPartitions < 2) || c->levelizedActive) return false;
+	if((gatePartition.size() != c->compiledGates.size()) || (groupOwner.size() != c->junctionGroups.size())) return false;
+
+	lookahead = TIME_NONE;
+	for(unsigned long g = 0; g < c->compiledGates.size(); g++) {
+		Gate* myGate = c->compiledGates[g];
+
+		// The gates have to keep to themselves while they are updated:
+		if(!myGate->canUpdateInParallel() && (myGate->getScheduleRole() != SCHEDULE_PASSIVE)) return false;
+
+		// Inertial delay cancels events, which can't be done across partitions:
+		DelayModeType gateDelayMode = myGate->getDelayMode();
+		if(gateDelayMode == DELAY_DEFAULT) gateDelayMode = c->delayMode;
+		if(gateDelayMode == DELAY_INERTIAL) return false;
+
+		// Bus events change lines that may be in different partitions:
+		for(unsigned long i = 0; i < myGate->outputBuses.size(); i++) {
+			if(myGate->outputBuses[i].eventSource != SOURCE_NONE) return false;
+		}
+
+		// The lookahead is the shortest delay of the gates that send events
+		// to other partitions(self-scheduling gates send theirs with no delay):
+		unsigned long myPart = gatePartition[g];
+		if(myPart == ID_NONE) continue;
+		TimeType gateDelay = (myGate->getWakeUpSource() != SOURCE_NONE) ? 0 : myGate->defaultDelay;
+		for(PinType i = 0; i < myGate->outputList.size(); i++) {
+			SourceType source = myGate->getOutputSource(i);
+			if(source == SOURCE_NONE) continue;
+			IDType groupID = getSourceGroup(source);
+			if((groupOwner[groupID] != myPart) || (groupGhostStart[groupID] != groupGhostStart[groupID + 1])) {
+				lookahead = min(lookahead, gateDelay);
+			}
+		}
+	}
+
+	return(lookahead > 0);
+}
+
+
+// Run the circuit until the Circuit's systemTime reaches endTime:
+bool PartitionEngine::run(TimeType endTime, ID_SET< IDType > *changedWires) {
+	Circuit* c = theCircuit;
+	if(!canRun()) return false;
+
+	// Take the events out of the Circuit's queue. Junction and bus events
+	// can't be run partitioned, so if there are any, put them all back:
+	vector< Event > pendingEvents;
+	bool canHandle = true;
+	while(!c->eventQueue.empty()) {
+		Event myEvent = c->eventQueue.top();
+		c->eventQueue.pop();
+		if(c->isCancelled(myEvent)) {
+			c->freeBusEventValue(myEvent);
+			continue;
+		}
+		if((myEvent.eventType == EVENT_JUNCTION) || (myEvent.eventType == EVENT_BUS)) canHandle = false;
+		pendingEvents.push_back(myEvent);
+	}
+	if(!canHandle) {
+		for(unsigned long i = 0; i < pendingEvents.size(); i++) c->eventQueue.push(pendingEvents[i]);
+		return false;
+	}
+
+	startRun(pendingEvents);
+
+	WindowTask windowTask(this);
+	vector< TimedParam > windowParams;
+	TimeType now = c->systemTime;
+	while(true) {
+		// Find the next timestep with something to do:
+		TimeType nextTime = TIME_NONE;
+		for(unsigned long k = 0; k < numPartitions; k++) {
+			if(!partitions[k].eventQueue.empty()) nextTime = min(nextTime, partitions[k].eventQueue.top().eventTime);
+		}
+		for(unsigned long i = 0; i < stimulusWakeUps.size(); i++) {
+			nextTime = min(nextTime, stimulusWakeUps[i]);
+		}
+		if((nextTime == TIME_NONE) || (nextTime >= endTime)) break;
+		nextTime = max(nextTime, now);
+
+		// The window is as long as the lookahead, so nothing sent from one
+		// partition to another during it can be due before it ends:
+		TimeType windowEnd = endTime;
+		if((lookahead != TIME_NONE) && (endTime - nextTime > lookahead)) windowEnd = nextTime + lookahead;
+
+		runStimulusGates(nextTime, windowEnd);
+		for(unsigned long k = 0; k < numPartitions; k++) {
+			partitions[k].windowStart = nextTime;
+			partitions[k].windowEnd = windowEnd;
+		}
+		c->threadPool.run(&windowTask, numPartitions, 1);
+
+		// Pass the events between the partitions, and collect the changed
+		// wires and parameter changes, in partition order:
+		windowParams.swap(stimulusParams);
+		for(unsigned long k = 0; k < numPartitions; k++) {
+			Partition &thePart = partitions[k];
+			for(unsigned long i = 0; i < thePart.outbox.size(); i++) {
+				pushEvent(thePart.outbox[i].first, thePart.outbox[i].second);
+			}
+			thePart.outbox.clear();
+
+			c->changedWireList.insert(c->changedWireList.end(), thePart.changedWires.begin(), thePart.changedWires.end());
+			if(changedWires != NULL) changedWires->insert(thePart.changedWires.begin(), thePart.changedWires.end());
+			thePart.changedWires.clear();
+			for(unsigned long i = 0; i < thePart.loggedWires.size(); i++) {
+				TimedWire &theChange = thePart.loggedWires[i];
+				c->changeLog->push_back(LoggedChange(theChange.changeTime, theChange.wireID, "", theChange.newState));
+			}
+			thePart.loggedWires.clear();
+
+			windowParams.insert(windowParams.end(), thePart.params.begin(), thePart.params.end());
+			thePart.params.clear();
+		}
+
+		// Keep the parameter changes in time order:
+		if(!windowParams.empty()) {
+			stable_sort(windowParams.begin(), windowParams.end(), earlierParam);
+			for(unsigned long i = 0; i < windowParams.size(); i++) {
+				c->addUpdateParam(windowParams[i].gateID, windowParams[i].paramName, windowParams[i].paramTime);
+			}
+			windowParams.clear();
+		}
+
+		now = windowEnd;
+	}
+
+	finishRun(endTime);
+	return true;
+}
+
+
+// Hand the Circuit's events, wire states and gate inputs over to the partitions:
+void PartitionEngine::startRun(vector< Event > &pendingEvents) {
+	Circuit* c = theCircuit;
+
+	c->changedWireList.clear();
+	for(unsigned long k = 0; k < numPartitions; k++) {
+		Partition &thePart = partitions[k];
+		thePart.eventQueue.clear();
+		thePart.eventSequence = c->eventSequence;
+		thePart.stepCount = c->stepCount;
+		thePart.eventCount = 0;
+		thePart.sourceStates.assign(c->eventSources.size(), UNKNOWN);
+
+		// Copy the ghosts' wires' drivers and states:
+		for(unsigned long i = 0; i < thePart.ghosts.size(); i++) {
+			Ghost &theGhost = thePart.ghosts[i];
+			Circuit::JunctionGroup &theGroup = c->junctionGroups[theGhost.groupID];
+			theGhost.drivers = theGroup.drivers;
+			theGhost.state = theGroup.wires.empty() ? UNKNOWN : c->wireList.get(theGroup.wires[0])->getState();
+			theGhost.stepMark = 0;
+
+			for(unsigned long j = 0; j < theGroup.wires.size(); j++) {
+				Wire* myWire = c->wireList.get(theGroup.wires[j]);
+				ID_SET< WireInput >::iterator thisInput = myWire->inputList.begin();
+				while(thisInput != myWire->inputList.end()) {
+					Gate* inputGate = c->gateList.get(thisInput->gateID);
+					SourceType source = (inputGate != NULL) ? inputGate->getOutputSource(thisInput->gateOutputPin) : SOURCE_NONE;
+					if(source != SOURCE_NONE) thePart.sourceStates[source] = thisInput->inputState;
+					thisInput++;
+				}
+			}
+		}
+
+		// Point the gate inputs at the ghosts:
+		for(unsigned long i = 0; i < thePart.ghostInputs.size(); i++) {
+			GhostInput &theInput = thePart.ghostInputs[i];
+			theInput.gate->inputList[theInput.inputPin].wireState = &(thePart.ghosts[theInput.ghost].state);
+		}
+	}
+
+	// Hand out the events, in the order they were in the queue:
+	stimulusWakeUps.assign(stimulusGates.size(), TIME_NONE);
+	for(unsigned long i = 0; i < pendingEvents.size(); i++) {
+		Event &myEvent = pendingEvents[i];
+		if(myEvent.eventType == EVENT_WAKE_UP) {
+			IDType gateIndex = c->gateList.get(c->eventSources[myEvent.source].gateID)->compiledIndex;
+			if(gatePartition[gateIndex] != ID_NONE) {
+				pushEvent(gatePartition[gateIndex], myEvent);
+			} else {
+				unsigned long stimulus = lower_bound(stimulusGates.begin(), stimulusGates.end(), gateIndex) - stimulusGates.begin();
+				stimulusWakeUps[stimulus] = min(stimulusWakeUps[stimulus], myEvent.eventTime);
+			}
+		} else {
+			routeEvent(ID_NONE, myEvent);
+		}
+	}
+}
+
+
+// Take the events, wire states and gate inputs back from the partitions:
+void PartitionEngine::finishRun(TimeType endTime) {
+	Circuit* c = theCircuit;
+
+	// Collect the events that are still to come, leaving out the copies that
+	// were sent to the ghosts:
+	vector< Event > pendingEvents;
+	for(unsigned long k = 0; k < numPartitions; k++) {
+		Partition &thePart = partitions[k];
+		c->eventSequence = max(c->eventSequence, thePart.eventSequence);
+		c->stepCount = max(c->stepCount, thePart.stepCount);
+		c->eventCount += thePart.eventCount;
+
+		while(!thePart.eventQueue.empty()) {
+			Event myEvent = thePart.eventQueue.top();
+			thePart.eventQueue.pop();
+			if(c->isCancelled(myEvent)) continue;
+			if((myEvent.eventType == EVENT_WIRE) && (groupOwner[getSourceGroup(myEvent.source)] != k)) continue;
+			pendingEvents.push_back(myEvent);
+		}
+
+		// Point the gate inputs back at their wires:
+		for(unsigned long i = 0; i < thePart.ghostInputs.size(); i++) {
+			GateInput &theInput = thePart.ghostInputs[i].gate->inputList[thePart.ghostInputs[i].inputPin];
+			theInput.wireState = &(c->wireList.get(theInput.wireID)->wireState);
+		}
+	}
+
+	// Put them back in the Circuit's queue, after any sequence numbers that
+	// the partitions have used:
+	for(unsigned long i = 0; i < pendingEvents.size(); i++) {
+		pendingEvents[i].sequence = c->eventSequence++;
+		c->eventQueue.push(pendingEvents[i]);
+	}
+	for(unsigned long i = 0; i < stimulusGates.size(); i++) {
+		if(stimulusWakeUps[i] != TIME_NONE) {
+			c->scheduleWakeUp(c->compiledGates[stimulusGates[i]], stimulusWakeUps[i]);
+		}
+	}
+
+	c->systemTime = endTime;
+}
+
+
+// Run the timesteps of the current window in one partition:
+void PartitionEngine::runWindow(unsigned long partition) {
+	Partition &thePart = partitions[partition];
+	while(!thePart.eventQueue.empty()) {
+		TimeType stepTime = thePart.eventQueue.top().eventTime;
+		if(stepTime >= thePart.windowEnd) break;
+		runStep(partition, max(stepTime, thePart.windowStart));
+	}
+}
+
+
+// Run one timestep in one partition, the same way as Circuit::step():
+void PartitionEngine::runStep(unsigned long partition, TimeType stepTime) {
+	Circuit* c = theCircuit;
+	Partition &thePart = partitions[partition];
+
+	thePart.stepCount++;
+	thePart.dirtyWires.clear();
+	thePart.dirtyGhosts.clear();
+	thePart.changedGates.clear();
+
+	// Make the events that are due happen:
+	while(!thePart.eventQueue.empty() && (thePart.eventQueue.top().eventTime <= stepTime)) {
+		Event myEvent = thePart.eventQueue.top();
+		thePart.eventQueue.pop();
+		if(c->isCancelled(myEvent)) continue;
+
+		Circuit::EventSource &mySource = c->eventSources[myEvent.source];
+		if(myEvent.eventType == EVENT_WAKE_UP) {
+			Gate* myGate = c->gateList.get(mySource.gateID);
+			myGate->heldCalls = &(thePart.gateCalls);
+			myGate->updateGate(mySource.gateID, c, stepTime);
+			myGate->heldCalls = NULL;
+			sendGateCalls(partition, myGate, mySource.gateID, stepTime, thePart.gateCalls, thePart.params);
+			scheduleWakeUp(partition, myGate, stepTime + 1);
+			thePart.eventCount++;
+			continue;
+		}
+
+		Wire* myWire = c->wireList.get(mySource.wireID);
+		IDType groupID = myWire->junctionGroup;
+		if(groupOwner[groupID] == partition) {
+			// Set the wire's input, as in Circuit::setWireInput():
+			//(Only the owner counts the event, not the ghosts.)
+			thePart.eventCount++;
+			StateType oldState = myWire->setInputState(mySource.gateID, mySource.gateOutputPin, myEvent.newState);
+			Circuit::JunctionGroup &wireGroup = c->junctionGroups[groupID];
+			wireGroup.drivers.remove(oldState);
+			wireGroup.drivers.add(myEvent.newState);
+			if(myWire->stepMark != thePart.stepCount) {
+				myWire->stepMark = thePart.stepCount;
+				thePart.dirtyWires.push_back(mySource.wireID);
+			}
+		} else {
+			// Or the ghost's:
+			unsigned long ghostIndex = thePart.groupGhosts[groupID];
+			Ghost &theGhost = thePart.ghosts[ghostIndex];
+			StateType &sourceState = thePart.sourceStates[myEvent.source];
+			theGhost.drivers.remove(sourceState);
+			theGhost.drivers.add(myEvent.newState);
+			sourceState = myEvent.newState;
+			if(theGhost.stepMark != thePart.stepCount) {
+				theGhost.stepMark = thePart.stepCount;
+				thePart.dirtyGhosts.push_back(ghostIndex);
+			}
+		}
+	}
+
+	// Work out the new wire states, and find the partition's gates to update:
+	for(unsigned long i = 0; i < thePart.dirtyWires.size(); i++) {
+		Circuit::JunctionGroup &wireGroup = c->junctionGroups[c->wireList.get(thePart.dirtyWires[i])->junctionGroup];
+		if(wireGroup.stepMark == thePart.stepCount) continue;
+		wireGroup.stepMark = thePart.stepCount;
+
+		StateType juncState = wireGroup.drivers.resolve();
+		for(unsigned long j = 0; j < wireGroup.wires.size(); j++) {
+			Wire* groupWire = c->wireList.get(wireGroup.wires[j]);
+			if(groupWire->getState() == juncState) continue;
+
+			groupWire->forceState(juncState);
+			thePart.changedWires.push_back(wireGroup.wires[j]);
+			if(c->changeLog != NULL) thePart.loggedWires.push_back(TimedWire(stepTime, wireGroup.wires[j], juncState));
+
+			unsigned long fanoutEnd = c->fanoutStart[groupWire->compiledIndex + 1];
+			for(unsigned long k = c->fanoutStart[groupWire->compiledIndex]; k < fanoutEnd; k++) {
+				IDType gateIndex = c->fanoutGates[k];
+				if(gatePartition[gateIndex] != partition) continue;
+				Gate* myGate = c->compiledGates[gateIndex];
+				if(myGate->stepMark != thePart.stepCount) {
+					myGate->stepMark = thePart.stepCount;
+					thePart.changedGates.push_back(gateIndex);
+				}
+			}
+		}
+	}
+	for(unsigned long i = 0; i < thePart.dirtyGhosts.size(); i++) {
+		Ghost &theGhost = thePart.ghosts[thePart.dirtyGhosts[i]];
+		StateType ghostState = theGhost.drivers.resolve();
+		if(ghostState == theGhost.state) continue;
+		theGhost.state = ghostState;
+
+		for(unsigned long j = 0; j < theGhost.readers.size(); j++) {
+			Gate* myGate = c->compiledGates[theGhost.readers[j]];
+			if(myGate->stepMark != thePart.stepCount) {
+				myGate->stepMark = thePart.stepCount;
+				thePart.changedGates.push_back(theGhost.readers[j]);
+			}
+		}
+	}
+
+	// Update the gates, in order of gate ID:
+	sort(thePart.changedGates.begin(), thePart.changedGates.end());
+	for(unsigned long i = 0; i < thePart.changedGates.size(); i++) {
+		Gate* myGate = c->compiledGates[thePart.changedGates[i]];
+		IDType gateID = c->compiledGateIDs[thePart.changedGates[i]];
+
+		myGate->heldCalls = &(thePart.gateCalls);
+		myGate->updateGate(gateID, c, stepTime);
+		myGate->heldCalls = NULL;
+		sendGateCalls(partition, myGate, gateID, stepTime, thePart.gateCalls, thePart.params);
+		scheduleWakeUp(partition, myGate, stepTime + 1);
+	}
+}
+
+
+// Update the stimulus gates that wake up before windowEnd:
+void PartitionEngine::runStimulusGates(TimeType windowStart, TimeType windowEnd) {
+	Circuit* c = theCircuit;
+	for(unsigned long i = 0; i < stimulusGates.size(); i++) {
+		Gate* myGate = c->compiledGates[stimulusGates[i]];
+		IDType gateID = c->compiledGateIDs[stimulusGates[i]];
+
+		while(stimulusWakeUps[i] < windowEnd) {
+			TimeType wakeTime = max(stimulusWakeUps[i], windowStart);
+			myGate->heldCalls = &stimulusCalls;
+			myGate->updateGate(gateID, c, wakeTime);
+			myGate->heldCalls = NULL;
+			sendGateCalls(ID_NONE, myGate, gateID, wakeTime, stimulusCalls, stimulusParams);
+			c->eventCount++;
+
+			stimulusWakeUps[i] = myGate->getWakeUpTime(wakeTime + 1);
+			if(stimulusWakeUps[i] <= wakeTime) stimulusWakeUps[i] = wakeTime + 1;
+		}
+	}
+}
+
+
+// Send the events that a gate made while it was being updated to the
+// partitions that need them, and keep its parameter changes:
+void PartitionEngine::sendGateCalls(unsigned long fromPartition, Gate* theGate, IDType gateID, TimeType callTime, vector< GateCall > &calls, vector< TimedParam > &params) {
+	for(unsigned long i = 0; i < calls.size(); i++) {
+		GateCall &theCall = calls[i];
+		if(theCall.callType == GATE_CALL_EVENT) {
+			SourceType source = theGate->getOutputSource(theCall.outputPin);
+			if(source == SOURCE_NONE) continue;
+
+			Event myEvent;
+			myEvent.eventTime = theCall.eventTime;
+			myEvent.sequence = 0;
+			myEvent.source = source;
+			myEvent.eventType = EVENT_WIRE;
+			myEvent.newState = theCall.newState;
+			myEvent.busValue = 0;
+			routeEvent(fromPartition, myEvent);
+		} else if(theCall.callType == GATE_CALL_PARAM) {
+			params.push_back(TimedParam(callTime, gateID, theCall.paramName));
+		}
+		//(There are no bus events, since run() won't take a circuit with a
+		// connected output bus.)
+	}
+	calls.clear();
+}
+
+
+// Send an event to the owner of its wire and to the wire's ghosts:
+void PartitionEngine::routeEvent(unsigned long fromPartition, const Event &theEvent) {
+	IDType groupID = getSourceGroup(theEvent.source);
+
+	unsigned long toPartition = groupOwner[groupID];
+	unsigned long ghostIndex = groupGhostStart[groupID];
+	while(true) {
+		if((fromPartition == ID_NONE) || (toPartition == fromPartition)) {
+			pushEvent(toPartition, theEvent);
+		} else {
+			partitions[fromPartition].outbox.push_back(make_pair(toPartition, theEvent));
+		}
+
+		if(ghostIndex == groupGhostStart[groupID + 1]) break;
+		toPartition = groupGhostParts[ghostIndex++];
+	}
+}
+
+
+// Give a self-scheduling gate in a partition its next wake-up:
+void PartitionEngine::scheduleWakeUp(unsigned long partition, Gate* theGate, TimeType fromTime) {
+	SourceType source = theGate->getWakeUpSource();
+	if(source == SOURCE_NONE) return;
+
+	// Cancel the gate's pending wake-up, as in Circuit::scheduleWakeUp():
+	theCircuit->eventSources[source].cancelSequence = partitions[partition].eventSequence;
+	TimeType wakeTime = theGate->getWakeUpTime(fromTime);
+	if(wakeTime == TIME_NONE) return;
+
+	Event myEvent;
+	myEvent.eventTime = wakeTime;
+	myEvent.sequence = 0;
+	myEvent.source = source;
+	myEvent.eventType = EVENT_WAKE_UP;
+	myEvent.newState = UNKNOWN;
+	myEvent.busValue = 0;
+	pushEvent(partition, myEvent);
+}
+
+
+// Return the junction group that an event source's wire is in:
+IDType PartitionEngine::getSourceGroup(SourceType source) {
+	return theCircuit->wireList.get(theCircuit->eventSources[source].wireID)->junctionGroup;
+}
@@ -0,0 +1,228 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_partition: Runs the Circuit's event simulation split up into
+   partitions, each on its own thread
+*****************************************************************************/
+
+#ifndef LOGIC_PARTITION_H_
+#define LOGIC_PARTITION_H_
+
+#include "logic_defaults.h"
+#include "logic_event.h"
+#include "logic_event_queue.h"
+#include "logic_wire.h"
+#include "logic_gate.h"
+#include "logic_thread_pool.h"
+
+#include <vector>
+
+class Circuit;
+
+// A PartitionEngine runs the Circuit's event simulation with the circuit cut
+// up into partitions, each with its own event queue, so that the partitions
+// can be run on different threads. It is what Circuit::runUntil() uses once
+// Circuit::setPartitionCount() has been set.
+//
+// The partitions are synchronized conservatively. An event sent from one
+// partition to another is always at least "lookahead" timesteps away(the
+// shortest delay of the gates that drive a wire in another partition), so the
+// partitions can each run through a window of that many timesteps on their
+// own, and then pass their events over to each other. The window never lets a
+// partition see an event too late, so the run comes out the same as with the
+// sequential engine, whatever the number of threads.
+//
+// A wire(with its whole junction group) belongs to one partition, which keeps
+// its real state. Every other partition that has gates reading the wire keeps
+// a "ghost" of it: a copy of its drivers and state, which is sent the same
+// events as the wire and which the gates there read instead. So the only
+// thing passed between partitions is events.
+//
+// The CLOCK and PULSE gates with no inputs don't belong to any partition. They
+// only depend on the time, so they are run ahead of each window and their
+// events are handed straight to the partitions, which keeps their zero-delay
+// outputs from cutting the lookahead down to nothing.
+//
+// A circuit can only be run partitioned if all of its gates can be updated in
+// parallel(see Gate::canUpdateInParallel(), except for the TO/FROM junction
+// gates, which do nothing when updated), with transport delays, no connected
+// output buses and no junction events pending. run() returns false for any
+// other circuit, and the Circuit runs it with the sequential engine instead.
+class PartitionEngine
+{
+public:
+	PartitionEngine(Circuit* newCircuit);
+	virtual ~PartitionEngine();
+
+	// Cut the circuit into numPartitions partitions. The gates are grown into
+	// partitions of about the same size along the wires, and then moved
+	// between them to cut as few wires as possible. The wires tied together
+	// by junctions are always kept in one partition:
+	//(The Circuit's compiled connectivity has to be up to date.)
+	void compile(unsigned long numPartitions);
+
+	// Run the circuit until the Circuit's systemTime reaches endTime. Returns
+	// false, without doing anything, if the circuit can't be run partitioned:
+	bool run(TimeType endTime, ID_SET< IDType > *changedWires);
+
+	// The number of wires(junction groups) that are cut between partitions,
+	// and the lookahead of the last run(TIME_NONE if nothing was cut):
+	unsigned long getCutWireCount(void) { return cutWireCount; };
+	TimeType getLookahead(void) { return lookahead; };
+
+private:
+	// A partition's copy of a wire that belongs to another partition:
+	struct Ghost {
+		IDType groupID;
+		DriverCount drivers;
+		StateType state;
+		unsigned long long stepMark;
+		vector< IDType > readers; // The compiled indexes of the gates reading it.
+	};
+
+	// A gate input that reads a ghost:
+	struct GhostInput {
+		Gate* gate;
+		PinType inputPin;
+		unsigned long ghost;
+	};
+
+	// A parameter change made by a gate during the run:
+	struct TimedParam {
+		TimeType paramTime;
+		IDType gateID;
+		string paramName;
+		TimedParam(TimeType paramTime, IDType gateID, string paramName) :
+			paramTime(paramTime), gateID(gateID), paramName(paramName) {};
+	};
+
+	// A wire change made during the run, for the Circuit's change log:
+	struct TimedWire {
+		TimeType changeTime;
+		IDType wireID;
+		StateType newState;
+		TimedWire(TimeType changeTime, IDType wireID, StateType newState) :
+			changeTime(changeTime), wireID(wireID), newState(newState) {};
+	};
+
+	// Sort the parameter changes by time:
+	static bool earlierParam(const TimedParam &left, const TimedParam &right) {
+		return(left.paramTime < right.paramTime);
+	};
+
+	struct Partition {
+		EventQueue eventQueue;
+		unsigned long long eventSequence;
+		unsigned long long stepCount;
+		unsigned long long eventCount; // The events made to happen, for Circuit::getEventCount().
+
+		// The partition's ghosts, and the ghost of each junction group(or
+		// ID_NONE). sourceStates holds the last state sent by each event
+		// source that drives a ghost:
+		vector< Ghost > ghosts;
+		vector< unsigned long > groupGhosts;
+		vector< GhostInput > ghostInputs;
+		vector< StateType > sourceStates;
+
+		// The work lists for a timestep, like the Circuit's:
+		vector< IDType > dirtyWires;
+		vector< unsigned long > dirtyGhosts;
+		vector< IDType > changedGates;
+		vector< GateCall > gateCalls;
+
+		// What the partition passes back at the end of a window: the events
+		// for other partitions(with the partition each one is for), the wires
+		// that changed state, and the gates' parameter changes:
+		vector< pair< unsigned long, Event > > outbox;
+		vector< IDType > changedWires;
+		vector< TimedParam > params;
+
+		// The wire changes for the Circuit's change log, if it has one:
+		vector< TimedWire > loggedWires;
+
+		// The window being run:
+		TimeType windowStart;
+		TimeType windowEnd;
+	};
+
+	// The thread pool's task, which runs a window in each partition:
+	class WindowTask : public ThreadTask {
+	public:
+		WindowTask(PartitionEngine* newEngine) : theEngine(newEngine) {};
+		void runItems(unsigned long threadIndex, unsigned long first, unsigned long last) {
+			for(unsigned long i = first; i < last; i++) theEngine->runWindow(i);
+		};
+	private:
+		PartitionEngine* theEngine;
+	};
+	friend class WindowTask;
+
+	// Can the circuit be run partitioned? Also works out the lookahead:
+	bool canRun(void);
+
+	// Hand the Circuit's events, wire states and gate inputs over to the
+	// partitions, and take them back again:
+	void startRun(vector< Event > &pendingEvents);
+	void finishRun(TimeType endTime);
+
+	// Run the timesteps of the current window in one partition:
+	void runWindow(unsigned long partition);
+
+	// Run one timestep in one partition:
+	void runStep(unsigned long partition, TimeType stepTime);
+
+	// Update the stimulus gates that wake up before windowEnd:
+	void runStimulusGates(TimeType windowStart, TimeType windowEnd);
+
+	// Send the events that a gate made while it was being updated to the
+	// partitions that need them, and keep its parameter changes.
+	//(fromPartition is ID_NONE for a stimulus gate.)
+	void sendGateCalls(unsigned long fromPartition, Gate* theGate, IDType gateID, TimeType callTime, vector< GateCall > &calls, vector< TimedParam > &params);
+
+	// Send an event to the owner of its wire and to the wire's ghosts:
+	//(Events for fromPartition go straight into its queue, and the others go
+	// in its outbox. With fromPartition ID_NONE they all go straight in.)
+	void routeEvent(unsigned long fromPartition, const Event &theEvent);
+
+	// Put an event in a partition's queue, giving it the partition's next
+	// sequence number:
+	void pushEvent(unsigned long partition, Event theEvent) {
+		theEvent.sequence = partitions[partition].eventSequence++;
+		partitions[partition].eventQueue.push(theEvent);
+	};
+
+	// Give a self-scheduling gate in a partition its next wake-up:
+	void scheduleWakeUp(unsigned long partition, Gate* theGate, TimeType fromTime);
+
+	// Return the junction group that an event source's wire is in:
+	IDType getSourceGroup(SourceType source);
+
+	Circuit* theCircuit;
+	unsigned long numPartitions;
+
+	// The partition of each compiled gate(ID_NONE for a stimulus gate), and
+	// the compiled indexes of the stimulus gates with their next wake-ups:
+	vector< unsigned long > gatePartition;
+	vector< IDType > stimulusGates;
+	vector< TimeType > stimulusWakeUps;
+	vector< GateCall > stimulusCalls;
+	vector< TimedParam > stimulusParams;
+
+	// The partition that owns each junction group, and the partitions that
+	// have ghosts of it(group g's are groupGhostParts[groupGhostStart[g] ..
+	// groupGhostStart[g + 1] - 1]):
+	vector< unsigned long > groupOwner;
+	vector< unsigned long > groupGhostStart;
+	vector< unsigned long > groupGhostParts;
+
+	vector< Partition > partitions;
+
+	unsigned long cutWireCount;
+	TimeType lookahead;
+};
+
+#endif /*LOGIC_PARTITION_H_*/
@@ -0,0 +1,93 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_stats: Counters for where the Circuit's step() spends its time
+*****************************************************************************/
+
+#include "logic_stats.h"
+#include <algorithm>
+#include <iomanip>
+#include <time.h>
+
+const char* statsPhaseNames[STATS_PHASE_COUNT] = { "gate_updates", "events", "wires", "gates" };
+
+// Zero all of the counters:
+void CircuitStats::clear(void) {
+	steps = 0;
+	eventsPopped = 0;
+	eventsCancelled = 0;
+	queueHighWater = 0;
+	groupsWalked = 0;
+	wiresResolved = 0;
+	gatesEvaluated = 0;
+	for(unsigned long i = 0; i < gatesByType.size(); i++) gatesByType[i] = 0;
+	for(unsigned long i = 0; i < STATS_PHASE_COUNT; i++) phaseTime[i] = 0.0;
+}
+
+// Add another set of counters to these:
+void CircuitStats::add(const CircuitStats &other) {
+	steps += other.steps;
+	eventsPopped += other.eventsPopped;
+	eventsCancelled += other.eventsCancelled;
+	queueHighWater = max(queueHighWater, other.queueHighWater);
+	groupsWalked += other.groupsWalked;
+	wiresResolved += other.wiresResolved;
+	gatesEvaluated += other.gatesEvaluated;
+	if(gatesByType.size() < other.gatesByType.size()) gatesByType.resize(other.gatesByType.size(), 0);
+	for(unsigned long i = 0; i < other.gatesByType.size(); i++) gatesByType[i] += other.gatesByType[i];
+	for(unsigned long i = 0; i < STATS_PHASE_COUNT; i++) phaseTime[i] += other.phaseTime[i];
+}
+
+// Write a report of the gate profile:
+void writeProfileReport(ostream &out, const vector< GateProfileEntry > &byType, const vector< GateProfileEntry > &byGate, unsigned long maxGates) {
+	unsigned long long totalCalls = 0;
+	double totalSeconds = 0.0;
+	for(unsigned long i = 0; i < byType.size(); i++) {
+		totalCalls += byType[i].calls;
+		totalSeconds += byType[i].seconds;
+	}
+	ios_base::fmtflags oldFlags = out.flags();
+	streamsize oldPrecision = out.precision();
+	out << fixed;
+
+	out << "Gate profile: " << totalCalls << " updates, " << setprecision(6) << totalSeconds << " seconds" << endl;
+	out << endl << left << setw(16) << "type" << right << setw(14) << "calls" << setw(12) << "seconds"
+		<< setw(10) << "ns/call" << setw(8) << "%time" << endl;
+	for(unsigned long i = 0; i < byType.size(); i++) {
+		const GateProfileEntry &entry = byType[i];
+		out << left << setw(16) << entry.gateType << right << setw(14) << entry.calls
+			<< setw(12) << setprecision(6) << entry.seconds
+			<< setw(10) << setprecision(0) <<((entry.calls > 0) ? entry.seconds * 1e9 / entry.calls : 0.0)
+			<< setw(8) << setprecision(1) <<((totalSeconds > 0.0) ? entry.seconds * 100.0 / totalSeconds : 0.0) << endl;
+	}
+
+	out << endl << right << setw(5) << "rank" << setw(10) << "gate" << "  " << left << setw(16) << "type"
+		<< right << setw(14) << "calls" << setw(12) << "seconds" << setw(10) << "ns/call" << setw(8) << "%time" << endl;
+	for(unsigned long i = 0; i < byGate.size() && i < maxGates; i++) {
+		const GateProfileEntry &entry = byGate[i];
+		out << right << setw(5) << i + 1 << setw(10) << entry.gateID << "  " << left << setw(16) << entry.gateType
+			<< right << setw(14) << entry.calls
+			<< setw(12) << setprecision(6) << entry.seconds
+			<< setw(10) << setprecision(0) <<((entry.calls > 0) ? entry.seconds * 1e9 / entry.calls : 0.0)
+			<< setw(8) << setprecision(1) <<((totalSeconds > 0.0) ? entry.seconds * 100.0 / totalSeconds : 0.0) << endl;
+	}
+
+	out.flags(oldFlags);
+	out.precision(oldPrecision);
+}
+
+// The time in seconds since some fixed point:
+//(The monotonic clock is fine enough to time a single gate update.)
+double statsTime(void) {
+#ifdef UNIX
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return(double) now.tv_sec +(double) now.tv_nsec / 1000000000.0;
+#else
+	return(double) clock() /(double) CLOCKS_PER_SEC;
+#endif
+}
@@ -0,0 +1,105 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_stats: Counters for where the Circuit's step() spends its time
+*****************************************************************************/
+
+#ifndef LOGIC_STATS_H_
+#define LOGIC_STATS_H_
+
+#include "logic_defaults.h"
+#include <vector>
+#include <string>
+#include <iostream>
+
+using namespace std;
+
+// The counters are only compiled in when LOGIC_STATS is defined(see the
+// logic Makefile). Without it, LOGIC_STAT() statements vanish, and the
+// Circuit's stats stay empty. With it, they still cost only a test of the
+// Circuit's statsEnabled flag until Circuit::setStatsEnabled() is called:
+#ifdef LOGIC_STATS
+#define LOGIC_STAT(statement) \
+	if(statsEnabled) { statement; }
+#else
+#define LOGIC_STAT(statement)
+#endif
+
+// The same for the phase timers, which the timeline(see logic_trace.h) uses
+// as well as the stats:
+#ifdef LOGIC_STATS
+#define LOGIC_PHASE(statement) \
+	if(phaseTiming) { statement; }
+#else
+#define LOGIC_PHASE(statement)
+#endif
+
+// The phases of Circuit::step():
+#define STATS_PHASE_GATE_UPDATES 0 // The gates in the gate update list.
+#define STATS_PHASE_EVENTS       1 // Popping and applying the events.
+#define STATS_PHASE_WIRES        2 // Resolving the dirty wires' junction groups.
+#define STATS_PHASE_GATES        3 // Updating the gates on the changed wires.
+#define STATS_PHASE_COUNT        4
+
+// The phases' names, for reports and the timeline:
+extern const char* statsPhaseNames[STATS_PHASE_COUNT];
+
+// The counters for one or more timesteps of the event engine:
+struct CircuitStats {
+	// The number of calls to step() that were counted:
+	unsigned long long steps;
+
+	// The events taken off the queue, and how many of them had been
+	// cancelled and were thrown away:
+	unsigned long long eventsPopped;
+	unsigned long long eventsCancelled;
+
+	// The most events that were in the queue at the start of a step:
+	unsigned long long queueHighWater;
+
+	// The junction groups that had their state worked out, and the wires
+	// in them:
+	unsigned long long groupsWalked;
+	unsigned long long wiresResolved;
+
+	// The gate updates, in total and by gate type(indexed the same as
+	// Circuit::getGateTypeNames()):
+	unsigned long long gatesEvaluated;
+	vector< unsigned long long > gatesByType;
+
+	// The seconds spent in each STATS_PHASE_ of step():
+	double phaseTime[STATS_PHASE_COUNT];
+
+	CircuitStats() { clear(); };
+
+	// Zero all of the counters:
+	void clear(void);
+
+	// Add another set of counters to these(the high-water marks are
+	// combined with max()):
+	void add(const CircuitStats &other);
+};
+
+// The time spent updating a gate, or all of the gates of one type, while the
+// Circuit's gate profiler was on(see Circuit::setProfiling()):
+struct GateProfileEntry {
+	IDType gateID; // ID_NONE for a gate type's total.
+	string gateType;
+	unsigned long long calls;
+	double seconds;
+	GateProfileEntry() : gateID(ID_NONE), calls(0), seconds(0.0) {};
+};
+
+// Write a report of the gate profile, with the gate types and then the
+// maxGates hottest gates, each ranked by time:
+void writeProfileReport(ostream &out, const vector< GateProfileEntry > &byType, const vector< GateProfileEntry > &byGate, unsigned long maxGates);
+
+// The time in seconds since some fixed point, for timing the phases and
+// the gate updates:
+double statsTime(void);
+
+#endif /*LOGIC_STATS_H_*/
@@ -0,0 +1,177 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_thread_pool: Worker threads for splitting up the Circuit's work
+*****************************************************************************/
+
+#include "logic_thread_pool.h"
+#include "logic_trace.h"
+#include <sstream>
+
+
+ThreadPool::ThreadPool()
+{
+	threadCount = 1;
+	runTask = NULL;
+	runItemCount = 0;
+	runChunkSize = THREAD_POOL_CHUNK;
+	nextItem = 0;
+
+#ifdef UNIX
+	pthread_mutex_init(&mutex, NULL);
+	pthread_cond_init(&runStarted, NULL);
+	pthread_cond_init(&runFinished, NULL);
+	runNumber = 0;
+	busyWorkers = 0;
+	stopping = false;
+#endif
+}
+
+
+ThreadPool::~ThreadPool()
+{
+	stopThreads();
+
+#ifdef UNIX
+	pthread_cond_destroy(&runFinished);
+	pthread_cond_destroy(&runStarted);
+	pthread_mutex_destroy(&mutex);
+#endif
+}
+
+
+// Set the number of threads to run with, counting the thread that calls run():
+void ThreadPool::setThreadCount(unsigned long newCount) {
+	if(newCount < 1) newCount = 1;
+#ifndef UNIX
+	newCount = 1;
+#endif
+	if(newCount == threadCount) return;
+
+	stopThreads();
+	threadCount = newCount;
+
+#ifdef UNIX
+	workers.resize(threadCount - 1);
+	for(unsigned long i = 0; i < workers.size(); i++) {
+		workers[i].pool = this;
+		workers[i].threadIndex = i + 1;
+		workers[i].lastRun = runNumber;
+		if(pthread_create(&(workers[i].thread), NULL, workerMain, &(workers[i])) != 0) {
+			// Make do with the threads that did start:
+			WARNING("ThreadPool::setThreadCount() - Couldn't start a worker thread.");
+			workers.resize(i);
+			threadCount = i + 1;
+			break;
+		}
+	}
+#endif
+}
+
+
+// Do items 0 to numItems - 1 of a task across the threads:
+void ThreadPool::run(ThreadTask* task, unsigned long numItems, unsigned long chunkSize) {
+	runTask = task;
+	runItemCount = numItems;
+	runChunkSize = (chunkSize < 1) ? 1 : chunkSize;
+	nextItem = 0;
+
+#ifdef UNIX
+	if(!workers.empty()) {
+		// Wake the workers up, and do chunks alongside them:
+		pthread_mutex_lock(&mutex);
+		busyWorkers = workers.size();
+		runNumber++;
+		pthread_cond_broadcast(&runStarted);
+		pthread_mutex_unlock(&mutex);
+
+		runChunks(0);
+
+		pthread_mutex_lock(&mutex);
+		while(busyWorkers > 0) pthread_cond_wait(&runFinished, &mutex);
+		pthread_mutex_unlock(&mutex);
+
+		runTask = NULL;
+		return;
+	}
+#endif
+
+	task->runItems(0, 0, numItems);
+	runTask = NULL;
+}
+
+
+// Stop and join the worker threads:
+void ThreadPool::stopThreads(void) {
+#ifdef UNIX
+	if(workers.empty()) return;
+
+	pthread_mutex_lock(&mutex);
+	stopping = true;
+	pthread_cond_broadcast(&runStarted);
+	pthread_mutex_unlock(&mutex);
+
+	for(unsigned long i = 0; i < workers.size(); i++) {
+		pthread_join(workers[i].thread, NULL);
+	}
+	workers.clear();
+	stopping = false;
+#endif
+	threadCount = 1;
+}
+
+
+// Take chunks of the current run's items until there are none left:
+void ThreadPool::runChunks(unsigned long threadIndex) {
+	while(true) {
+#ifdef UNIX
+		unsigned long first = __sync_fetch_and_add(&nextItem, runChunkSize);
+#else
+		unsigned long first = nextItem;
+		nextItem += runChunkSize;
+#endif
+		if(first >= runItemCount) break;
+
+		unsigned long last = first + runChunkSize;
+		if(last > runItemCount) last = runItemCount;
+		runTask->runItems(threadIndex, first, last);
+	}
+}
+
+
+#ifdef UNIX
+// A worker thread waits for each run, and helps with it:
+void* ThreadPool::workerMain(void* theWorker) {
+	Worker* myWorker = (Worker*) theWorker;
+	ThreadPool* pool = myWorker->pool;
+
+	ostringstream oss;
+	oss << "logic worker " << myWorker->threadIndex;
+	traceThreadName(oss.str());
+
+	pthread_mutex_lock(&(pool->mutex));
+	while(true) {
+		while(!pool->stopping && (pool->runNumber == myWorker->lastRun)) {
+			pthread_cond_wait(&(pool->runStarted), &(pool->mutex));
+		}
+		if(pool->stopping) break;
+		myWorker->lastRun = pool->runNumber;
+		pthread_mutex_unlock(&(pool->mutex));
+
+		{
+			LOGIC_TRACE_SCOPE("thread pool run");
+			pool->runChunks(myWorker->threadIndex);
+		}
+
+		pthread_mutex_lock(&(pool->mutex));
+		if(--(pool->busyWorkers) == 0) pthread_cond_signal(&(pool->runFinished));
+	}
+	pthread_mutex_unlock(&(pool->mutex));
+
+	return NULL;
+}
+#endif
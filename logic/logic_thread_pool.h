@@ -0,0 +1,99 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_thread_pool: Worker threads for splitting up the Circuit's work
+*****************************************************************************/
+
+#ifndef LOGIC_THREAD_POOL_H_
+#define LOGIC_THREAD_POOL_H_
+
+#include "logic_defaults.h"
+
+#include <vector>
+
+#ifdef UNIX
+#include <pthread.h>
+#endif
+
+// The number of items that a thread takes at a time. Big enough that the
+// threads don't spend their time fighting over the counter, small enough
+// that a thread that gets slow items doesn't hold everyone up:
+#define THREAD_POOL_CHUNK 16
+
+// A job for the thread pool. runItems() is called from several threads at
+// once, each time with a different range of items:
+class ThreadTask
+{
+public:
+	virtual ~ThreadTask() {};
+
+	// Do items first to last - 1. threadIndex is which of the pool's threads
+	// is doing them(0 is the thread that called ThreadPool::run()), so that
+	// each thread can keep its results apart from the others':
+	virtual void runItems(unsigned long threadIndex, unsigned long first, unsigned long last) = 0;
+};
+
+// A pool of worker threads that are started once and then share out the
+// items of each run(). The items are handed out in chunks from a shared
+// counter, so a thread that finishes early just takes the next chunk.
+//
+// The threads are only available on UNIX builds(with pthreads). Elsewhere
+// the pool has just the one thread, and run() does all of the items itself.
+class ThreadPool
+{
+public:
+	ThreadPool();
+	virtual ~ThreadPool();
+
+	// Set the number of threads to run with, counting the thread that calls
+	// run(). 1 means no worker threads at all:
+	void setThreadCount(unsigned long newCount);
+	unsigned long getThreadCount(void) { return threadCount; };
+
+	// Do items 0 to numItems - 1 of a task across the threads, and return
+	// once they are all done. The threads take chunkSize items at a time:
+	void run(ThreadTask* task, unsigned long numItems, unsigned long chunkSize = THREAD_POOL_CHUNK);
+
+private:
+	// Stop and join the worker threads:
+	void stopThreads(void);
+
+	// Take chunks of the current run's items until there are none left:
+	void runChunks(unsigned long threadIndex);
+
+	unsigned long threadCount;
+
+	// The current run:
+	ThreadTask* runTask;
+	unsigned long runItemCount;
+	unsigned long runChunkSize;
+	volatile unsigned long nextItem;
+
+#ifdef UNIX
+	// A worker thread's start-up information:
+	struct Worker {
+		ThreadPool* pool;
+		unsigned long threadIndex;
+		pthread_t thread;
+		unsigned long long lastRun; // The last run that the worker has seen.
+	};
+	vector< Worker > workers;
+
+	static void* workerMain(void* theWorker);
+
+	// The workers wait on runStarted for the run number to change, and the
+	// caller waits on runFinished for busyWorkers to drop to 0:
+	pthread_mutex_t mutex;
+	pthread_cond_t runStarted;
+	pthread_cond_t runFinished;
+	unsigned long long runNumber;
+	unsigned long busyWorkers;
+	bool stopping;
+#endif
+};
+
+#endif /*LOGIC_THREAD_POOL_H_*/
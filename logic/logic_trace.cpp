@@ -0,0 +1,180 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_trace: A timeline of the simulator's threads, written out as a
+   Chrome trace-event file
+*****************************************************************************/
+
+#include "logic_trace.h"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <vector>
+
+// The timeline needs the UNIX build's thread-local storage, and is only
+// there with LOGIC_STATS:
+#if defined(UNIX) && defined(LOGIC_STATS)
+#define TRACE_THREADS
+#include <pthread.h>
+#endif
+
+volatile bool traceRecording = false;
+
+// The time that recording last started; earlier spans are left out:
+static double traceStartTime = 0.0;
+
+// A recorded span:
+struct TraceRecord {
+	const char* name;
+	double startTime;
+	double endTime;
+};
+
+// A thread's ring buffer. Only its own thread writes to it: each span is
+// filled in first, and then published by moving written up past it.
+// traceWrite() reads the spans below written, and throws away any that the
+// thread might have overwritten while they were being read:
+struct TraceBuffer {
+	string threadName;
+	unsigned long threadNumber;
+	TraceRecord* records;
+	volatile unsigned long long written;
+};
+
+#ifdef TRACE_THREADS
+// The calling thread's buffer:
+static __thread TraceBuffer* threadBuffer = NULL;
+
+// All of the threads' buffers, which are kept after their threads end so
+// that their spans still make it into the file. The lock is only taken when
+// a thread records for the first time, and by traceWrite():
+static vector< TraceBuffer* > traceBuffers;
+static pthread_mutex_t traceBuffersMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// Return the calling thread's buffer, making it if need be:
+static TraceBuffer* getThreadBuffer(void) {
+	if(threadBuffer == NULL) {
+		TraceBuffer* newBuffer = new TraceBuffer;
+		newBuffer->records = NULL;
+		newBuffer->written = 0;
+		pthread_mutex_lock(&traceBuffersMutex);
+		newBuffer->threadNumber = traceBuffers.size() + 1;
+		traceBuffers.push_back(newBuffer);
+		pthread_mutex_unlock(&traceBuffersMutex);
+		threadBuffer = newBuffer;
+	}
+	return threadBuffer;
+}
+
+// Write a string as a JSON string:
+static void writeJSONString(ostream &out, const string &text) {
+	out << '"';
+	for(unsigned long i = 0; i < text.size(); i++) {
+		if(text[i] == '"' || text[i] == '\\') out << '\\' << text[i];
+		else if((unsigned char) text[i] < ' ') out << ' ';
+		else out << text[i];
+	}
+	out << '"';
+}
+#endif
+
+// Start and stop recording:
+void traceStart(void) {
+	traceStartTime = statsTime();
+	traceRecording = true;
+}
+
+void traceStop(void) {
+	traceRecording = false;
+}
+
+// Name the calling thread on the timeline:
+void traceThreadName(string name) {
+#ifdef TRACE_THREADS
+	getThreadBuffer()->threadName = name;
+#endif
+}
+
+// Record a span on the calling thread:
+void traceEvent(const char* name, double startTime, double endTime) {
+#ifdef TRACE_THREADS
+	TraceBuffer* myBuffer = getThreadBuffer();
+	if(myBuffer->records == NULL) {
+		//(Published before written moves, like the spans themselves.)
+		TraceRecord* newRecords = new TraceRecord[TRACE_BUFFER_SIZE];
+		__sync_synchronize();
+		myBuffer->records = newRecords;
+	}
+	TraceRecord &theRecord = myBuffer->records[myBuffer->written % TRACE_BUFFER_SIZE];
+	theRecord.name = name;
+	theRecord.startTime = startTime;
+	theRecord.endTime = endTime;
+	__sync_synchronize();
+	myBuffer->written = myBuffer->written + 1;
+#endif
+}
+
+// Write the spans recorded since traceStart() to a trace-event file:
+bool traceWrite(string fileName) {
+	ofstream outFile(fileName.c_str());
+	if(!outFile) return false;
+
+	outFile << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[" << endl;
+#ifdef TRACE_THREADS
+	bool first = true;
+	pthread_mutex_lock(&traceBuffersMutex);
+	vector< TraceBuffer* > buffers = traceBuffers;
+	pthread_mutex_unlock(&traceBuffersMutex);
+
+	outFile << fixed << setprecision(3);
+	vector< TraceRecord > records;
+	for(unsigned long i = 0; i < buffers.size(); i++) {
+		TraceBuffer* theBuffer = buffers[i];
+
+		// Name the thread, even if it has nothing to show:
+		string threadName = theBuffer->threadName;
+		if(threadName == "") {
+			ostringstream oss;
+			oss << "thread " << theBuffer->threadNumber;
+			threadName = oss.str();
+		}
+		outFile <<(first ? "" : ",\n") << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << theBuffer->threadNumber << ",\"args\":{\"name\":";
+		writeJSONString(outFile, threadName);
+		outFile << "}}";
+		first = false;
+
+		// Copy the buffer's spans, and then keep the ones that weren't
+		// overwritten in the meantime(counting the span that the thread
+		// might be in the middle of writing):
+		unsigned long long writtenBefore = theBuffer->written;
+		__sync_synchronize();
+		TraceRecord* theRecords = theBuffer->records;
+		if(theRecords == NULL) continue;
+		unsigned long long firstRecord =(writtenBefore > TRACE_BUFFER_SIZE) ? writtenBefore - TRACE_BUFFER_SIZE : 0;
+		records.clear();
+		for(unsigned long long j = firstRecord; j < writtenBefore; j++) {
+			records.push_back(theRecords[j % TRACE_BUFFER_SIZE]);
+		}
+		__sync_synchronize();
+		unsigned long long writtenAfter = theBuffer->written;
+		unsigned long long firstValid =(writtenAfter + 1 > TRACE_BUFFER_SIZE) ? writtenAfter + 1 - TRACE_BUFFER_SIZE : 0;
+
+		for(unsigned long long j = max(firstRecord, firstValid); j < writtenBefore; j++) {
+			const TraceRecord &theRecord = records[j - firstRecord];
+			if(theRecord.startTime < traceStartTime) continue;
+			outFile << ",\n{\"ph\":\"X\",\"name\":";
+			writeJSONString(outFile, theRecord.name);
+			outFile << ",\"pid\":1,\"tid\":" << theBuffer->threadNumber
+				<< ",\"ts\":" <<(theRecord.startTime - traceStartTime) * 1000000.0
+				<< ",\"dur\":" <<(theRecord.endTime - theRecord.startTime) * 1000000.0 << "}";
+		}
+	}
+#endif
+	outFile << endl << "]}" << endl;
+	return outFile.good();
+}
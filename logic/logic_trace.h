@@ -0,0 +1,75 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_trace: A timeline of the simulator's threads, written out as a
+   Chrome trace-event file
+*****************************************************************************/
+
+#ifndef LOGIC_TRACE_H_
+#define LOGIC_TRACE_H_
+
+#include "logic_stats.h"
+#include <string>
+
+using namespace std;
+
+// The timeline records spans of time(a step() phase, a STEPSIM message, a
+// redraw) on whichever thread they happen on. Each thread records into its
+// own ring buffer without taking a lock, so the logic thread, the GUI thread
+// and the thread pool can all be recorded at once. When the buffer fills up,
+// the oldest spans are overwritten. traceWrite() puts the threads together on
+// one timeline, in the JSON format read by chrome://tracing and Perfetto.
+//
+// Like the stats, the timeline is only compiled in with LOGIC_STATS, and
+// only records anything between traceStart() and traceStop(). It needs the
+// UNIX build's thread-local storage; elsewhere nothing is recorded.
+#ifdef LOGIC_STATS
+#define LOGIC_TRACE_SCOPE(name) \
+	TraceScope traceScope(name)
+#else
+#define LOGIC_TRACE_SCOPE(name)
+#endif
+
+// The number of spans that each thread's buffer holds:
+#define TRACE_BUFFER_SIZE 65536
+
+// Start and stop recording. traceStart() also drops the spans that were
+// recorded before it:
+void traceStart(void);
+void traceStop(void);
+
+// Is the timeline being recorded?
+extern volatile bool traceRecording;
+inline bool traceIsOn(void) { return traceRecording; };
+
+// Name the calling thread on the timeline:
+void traceThreadName(string name);
+
+// Record a span from startTime to endTime(in statsTime() seconds) on the
+// calling thread. name has to be a string constant, since only the pointer
+// is kept:
+void traceEvent(const char* name, double startTime, double endTime);
+
+// Write the spans recorded since traceStart() to a trace-event file. Returns
+// false if the file can't be written:
+bool traceWrite(string fileName);
+
+// Records a span from its construction to the end of its scope(see
+// LOGIC_TRACE_SCOPE()):
+class TraceScope {
+public:
+	TraceScope(const char* newName) : name(newName), startTime(traceIsOn() ? statsTime() : 0.0) {};
+	~TraceScope() {
+		if(startTime != 0.0) traceEvent(name, startTime, statsTime());
+	};
+
+private:
+	const char* name;
+	double startTime;
+};
+
+#endif /*LOGIC_TRACE_H_*/
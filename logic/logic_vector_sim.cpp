@@ -0,0 +1,312 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_vector_sim: Runs many input vectors through a combinational
+   circuit at once
+*****************************************************************************/
+
+#include "logic_vector_sim.h"
+
+
+VectorSimulator::VectorSimulator(Circuit* newCircuit)
+{
+	theCircuit = newCircuit;
+	firstLoopGate = 0;
+}
+
+
+VectorSimulator::~VectorSimulator()
+{
+	releaseGates();
+}
+
+
+// Compile the circuit, with the given wires as its inputs:
+bool VectorSimulator::compile(const vector< IDType > &newInputWires) {
+	releaseGates();
+	inputWires = newInputWires;
+	netIndex.clear();
+	netStates.clear();
+	inputNets.clear();
+	outputStates.clear();
+	netDriverStart.clear();
+	netDrivers.clear();
+	gateOrder.clear();
+	gateNetStart.clear();
+	gateNets.clear();
+	firstLoopGate = 0;
+
+	// Number the input nets first:
+	for(unsigned long i = 0; i < inputWires.size(); i++) {
+		Wire* myWire = theCircuit->wireList.get(inputWires[i]);
+		if(myWire == NULL) {
+			WARNING("VectorSimulator::compile() - Invalid input wire ID.");
+			return false;
+		}
+		if(netIndex.find(myWire->junctionGroup) == netIndex.end()) {
+			netIndex[myWire->junctionGroup] = inputNets.size();
+			inputNets.push_back(true);
+		}
+	}
+
+	// Find the gates that drive the rest of the nets, and number those nets.
+	// Each gate output that drives one gets a place in outputStates:
+	vector< GATE_PTR > simGates;
+	vector< unsigned long > driverNets; // The net that each simulated output drives.
+	vector< vector< PinType > > simOutputs; // The simulated output pins of each gate.
+	ID_SET< IDType > gateIDs = theCircuit->gateList.getIDs();
+	ID_SET< IDType >::iterator thisGate = gateIDs.begin();
+	while(thisGate != gateIDs.end()) {
+		GATE_PTR myGate = theCircuit->gateList.getPtr(*thisGate);
+		vector< PinType > gateOutputs;
+		for(PinType pin = 0; pin < myGate->outputList.size(); pin++) {
+			Wire* myWire = theCircuit->wireList.get(myGate->outputList[pin].wireID);
+			if(myWire == NULL) continue;
+
+			ID_MAP< IDType, unsigned long >::iterator found = netIndex.find(myWire->junctionGroup);
+			unsigned long net;
+			if(found == netIndex.end()) {
+				net = inputNets.size();
+				netIndex[myWire->junctionGroup] = net;
+				inputNets.push_back(false);
+			} else {
+				net = found->second;
+			}
+			if(inputNets[net]) continue;
+
+			gateOutputs.push_back(pin);
+			driverNets.push_back(net);
+		}
+		thisGate++;
+
+		if(gateOutputs.empty()) continue;
+		if(!myGate->canProcessVectors()) {
+			WARNING("VectorSimulator::compile() - The circuit has a gate that can't be simulated with vectors.");
+			return false;
+		}
+		simGates.push_back(myGate);
+		simOutputs.push_back(gateOutputs);
+	}
+
+	// Number the nets that the simulated gates read from, too:
+	//(Nets that nothing drives just stay HI_Z.)
+	for(unsigned long g = 0; g < simGates.size(); g++) {
+		Gate* myGate = simGates[g].get();
+		for(PinType pin = 0; pin < myGate->inputList.size(); pin++) {
+			Wire* myWire = theCircuit->wireList.get(myGate->inputList[pin].wireID);
+			if((myWire != NULL) && (netIndex.find(myWire->junctionGroup) == netIndex.end())) {
+				netIndex[myWire->junctionGroup] = inputNets.size();
+				inputNets.push_back(false);
+			}
+		}
+	}
+	unsigned long numNets = inputNets.size();
+	netStates.assign(numNets, VectorState());
+	outputStates.assign(driverNets.size(), VectorState());
+
+	// Build the list of outputs driving each net:
+	netDriverStart.assign(numNets + 1, 0);
+	for(unsigned long k = 0; k < driverNets.size(); k++) {
+		netDriverStart[driverNets[k] + 1]++;
+	}
+	for(unsigned long n = 0; n < numNets; n++) {
+		netDriverStart[n + 1] += netDriverStart[n];
+	}
+	netDrivers.resize(driverNets.size());
+	vector< unsigned long > nextDriver(netDriverStart.begin(), netDriverStart.end() - 1);
+	for(unsigned long k = 0; k < driverNets.size(); k++) {
+		netDrivers[nextDriver[driverNets[k]]++] = k;
+	}
+
+	// Point the gates' inputs and outputs at the net and output states, and
+	// list the gates that read each net:
+	vector< vector< unsigned long > > netReaders(numNets);
+	vector< vector< unsigned long > > drivenNets(simGates.size());
+	unsigned long outputSlot = 0;
+	for(unsigned long g = 0; g < simGates.size(); g++) {
+		Gate* myGate = simGates[g].get();
+		for(PinType pin = 0; pin < myGate->inputList.size(); pin++) {
+			unsigned long net = getNet(myGate->inputList[pin].wireID);
+			if(net == ID_NONE) continue;
+			myGate->inputList[pin].vectorState = &netStates[net];
+			netReaders[net].push_back(g);
+		}
+		for(unsigned long i = 0; i < simOutputs[g].size(); i++) {
+			myGate->outputList[simOutputs[g][i]].vectorState = &outputStates[outputSlot];
+			drivenNets[g].push_back(driverNets[outputSlot]);
+			outputSlot++;
+		}
+		sort(drivenNets[g].begin(), drivenNets[g].end());
+		drivenNets[g].erase(unique(drivenNets[g].begin(), drivenNets[g].end()), drivenNets[g].end());
+	}
+
+	// Put the gates in the order that signals flow through them: a gate
+	// comes after all of the gates that drive its inputs. The gates that are
+	// left over are in loops(or after them), and go at the end:
+	vector< unsigned long > waitingInputs(simGates.size(), 0);
+	for(unsigned long g = 0; g < simGates.size(); g++) {
+		for(unsigned long i = 0; i < drivenNets[g].size(); i++) {
+			const vector< unsigned long > &readers = netReaders[drivenNets[g][i]];
+			for(unsigned long r = 0; r < readers.size(); r++) waitingInputs[readers[r]]++;
+		}
+	}
+	vector< unsigned long > order;
+	for(unsigned long g = 0; g < simGates.size(); g++) {
+		if(waitingInputs[g] == 0) order.push_back(g);
+	}
+	for(unsigned long next = 0; next < order.size(); next++) {
+		unsigned long g = order[next];
+		for(unsigned long i = 0; i < drivenNets[g].size(); i++) {
+			const vector< unsigned long > &readers = netReaders[drivenNets[g][i]];
+			for(unsigned long r = 0; r < readers.size(); r++) {
+				if(--waitingInputs[readers[r]] == 0) order.push_back(readers[r]);
+			}
+		}
+	}
+	firstLoopGate = order.size();
+	for(unsigned long g = 0; g < simGates.size(); g++) {
+		if(waitingInputs[g] != 0) order.push_back(g);
+	}
+
+	gateNetStart.push_back(0);
+	for(unsigned long i = 0; i < order.size(); i++) {
+		gateOrder.push_back(simGates[order[i]]);
+		gateNets.insert(gateNets.end(), drivenNets[order[i]].begin(), drivenNets[order[i]].end());
+		gateNetStart.push_back(gateNets.size());
+	}
+
+	return true;
+}
+
+
+// Set the states of one of the input wires in all of the lanes:
+void VectorSimulator::setInputVector(IDType wireID, const VectorState &newState) {
+	unsigned long net = getNet(wireID);
+	if((net == ID_NONE) || !inputNets[net]) {
+		WARNING("VectorSimulator::setInputVector() - Not an input wire.");
+		return;
+	}
+	netStates[net] = newState;
+}
+
+
+// Load up to VECTOR_LANES input vectors into the lanes, one vector per lane:
+void VectorSimulator::loadInputVectors(const vector< unsigned long long > &vectors) {
+	unsigned long numVectors = min((unsigned long)vectors.size(), (unsigned long)VECTOR_LANES);
+	for(unsigned long j = 0; (j < inputWires.size()) && (j < VECTOR_LANES); j++) {
+		// Gather up input j's bit from each vector:
+		LaneWord ones = 0;
+		for(unsigned long i = 0; i < numVectors; i++) {
+			ones |= (LaneWord)((vectors[i] >> j) & 1) << i;
+		}
+		setInputVector(inputWires[j], VectorState(~ones, ones));
+	}
+}
+
+
+// Work out the states of all of the wires from the input wires:
+void VectorSimulator::evaluate(void) {
+	// Each gate before the loops only needs updating once:
+	for(unsigned long g = 0; g < firstLoopGate; g++) {
+		gateOrder[g]->gateProcessVectors();
+		for(unsigned long i = gateNetStart[g]; i < gateNetStart[g + 1]; i++) {
+			resolveNet(gateNets[i]);
+		}
+	}
+
+	// Go around the loops until they settle, or give up when they don't(an
+	// oscillator never will):
+	unsigned long loopGates = gateOrder.size() - firstLoopGate;
+	bool changed = true;
+	for(unsigned long pass = 0; changed && (pass <= loopGates); pass++) {
+		changed = false;
+		for(unsigned long g = firstLoopGate; g < gateOrder.size(); g++) {
+			gateOrder[g]->gateProcessVectors();
+			for(unsigned long i = gateNetStart[g]; i < gateNetStart[g + 1]; i++) {
+				if(resolveNet(gateNets[i])) changed = true;
+			}
+		}
+	}
+}
+
+
+// Get the states of a wire in all of the lanes:
+VectorState VectorSimulator::getWireVector(IDType wireID) {
+	unsigned long net = getNet(wireID);
+	if(net == ID_NONE) {
+		WARNING("VectorSimulator::getWireVector() - Wire is not compiled.");
+		return VectorState();
+	}
+	return netStates[net];
+}
+
+
+// Read back the output vectors of the first numVectors lanes:
+vector< unsigned long long > VectorSimulator::getOutputVectors(const vector< IDType > &outputWires, unsigned long numVectors) {
+	numVectors = min(numVectors, (unsigned long)VECTOR_LANES);
+	vector< unsigned long long > outputVectors(numVectors, 0);
+	for(unsigned long j = 0; (j < outputWires.size()) && (j < VECTOR_LANES); j++) {
+		LaneWord ones = getWireVector(outputWires[j]).one;
+		for(unsigned long i = 0; i < numVectors; i++) {
+			outputVectors[i] |= (unsigned long long)((ones >> i) & 1) << j;
+		}
+	}
+	return outputVectors;
+}
+
+
+// Point the simulated gates' inputs and outputs back at nothing:
+void VectorSimulator::releaseGates(void) {
+	for(unsigned long g = 0; g < gateOrder.size(); g++) {
+		Gate* myGate = gateOrder[g].get();
+		for(PinType pin = 0; pin < myGate->inputList.size(); pin++) {
+			myGate->inputList[pin].vectorState = &unconnectedInputVector;
+		}
+		for(PinType pin = 0; pin < myGate->outputList.size(); pin++) {
+			myGate->outputList[pin].vectorState = NULL;
+		}
+	}
+	gateOrder.clear();
+}
+
+
+// Work out a net's state from the outputs driving it, the same way that
+// DriverCount::resolve() does for each lane, and return whether it changed:
+bool VectorSimulator::resolveNet(unsigned long net) {
+	VectorState drivers;
+	for(unsigned long i = netDriverStart[net]; i < netDriverStart[net + 1]; i++) {
+		const VectorState &driver = outputStates[netDrivers[i]];
+		drivers.zero |= driver.zero;
+		drivers.one |= driver.one;
+		drivers.unknown |= driver.unknown;
+		drivers.conflict |= driver.conflict;
+	}
+
+	// ZERO and ONE together are a CONFLICT, a known state beats UNKNOWN, and
+	// lanes with nothing driving them are HI_Z:
+	VectorState newState;
+	newState.conflict = drivers.conflict | (drivers.zero & drivers.one);
+	newState.one = drivers.one & ~newState.conflict;
+	newState.zero = drivers.zero & ~newState.conflict & ~drivers.one;
+	newState.unknown = drivers.unknown & ~(drivers.zero | drivers.one | drivers.conflict);
+
+	VectorState &oldState = netStates[net];
+	bool changed = (newState.zero != oldState.zero) || (newState.one != oldState.one)
+		|| (newState.unknown != oldState.unknown) || (newState.conflict != oldState.conflict);
+	oldState = newState;
+	return changed;
+}
+
+
+// Return the net that a wire is part of, or ID_NONE if it isn't compiled:
+unsigned long VectorSimulator::getNet(IDType wireID) {
+	Wire* myWire = theCircuit->wireList.get(wireID);
+	if(myWire == NULL) return ID_NONE;
+
+	ID_MAP< IDType, unsigned long >::iterator found = netIndex.find(myWire->junctionGroup);
+	return(found == netIndex.end()) ? ID_NONE : found->second;
+}
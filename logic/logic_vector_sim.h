@@ -0,0 +1,122 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   logic_vector_sim: Runs many input vectors through a combinational
+   circuit at once
+*****************************************************************************/
+
+#ifndef LOGIC_VECTOR_SIM_H_
+#define LOGIC_VECTOR_SIM_H_
+
+#include "logic_circuit.h"
+
+#include <vector>
+
+// A VectorSimulator works out a combinational circuit's outputs for
+// VECTOR_LANES independent sets of inputs("vectors") at once, which is much
+// faster than stepping the Circuit once for each of them when a test bench
+// has thousands of vectors to try.
+//
+// Every wire's state is kept as a VectorState, with one lane per vector, and
+// the gates work out all of the lanes together with word operations in their
+// gateProcessVectors(). There are no events or delays: compile() puts the
+// gates in the order that signals flow through them, and evaluate() updates
+// each one once, after the gates that drive its inputs. Gates in a loop are
+// updated over and over until they settle.
+//
+// Only the gates that can process vectors(the AND, OR, XOR, EQUIVALENCE,
+// BUFFER, MUX and DECODER gates) can be simulated. The junctions are taken
+// as they are at compile(), and the compiled circuit is only good until the
+// Circuit's gates or connections are changed.
+//
+// To use it:
+//		VectorSimulator vsim(theCircuit);
+//		if(vsim.compile(inputWires)) {
+//			vsim.loadInputVectors(vectors);
+//			vsim.evaluate();
+//			results = vsim.getOutputVectors(outputWires, vectors.size());
+//		}
+class VectorSimulator
+{
+public:
+	VectorSimulator(Circuit* newCircuit);
+	virtual ~VectorSimulator();
+
+	// Compile the circuit, with the given wires as its inputs. Whatever drives
+	// the input wires in the Circuit is ignored, and so are the gates that
+	// only drive input wires. Returns false if the circuit has a gate that
+	// can't be simulated:
+	bool compile(const vector< IDType > &newInputWires);
+
+	// Set the states of one of the input wires in all of the lanes:
+	void setInputVector(IDType wireID, const VectorState &newState);
+
+	// Load up to VECTOR_LANES input vectors into the lanes, one vector per
+	// lane. Bit j of vectors[i] is the state of input wire j(in the order
+	// given to compile()) in lane i. The unused lanes are set to ZERO:
+	void loadInputVectors(const vector< unsigned long long > &vectors);
+
+	// Work out the states of all of the wires from the input wires:
+	void evaluate(void);
+
+	// Get the states of a wire in all of the lanes:
+	VectorState getWireVector(IDType wireID);
+
+	// Get the state of a wire in one lane:
+	StateType getWireState(IDType wireID, unsigned long lane) {
+		return getWireVector(wireID).getLane(lane);
+	};
+
+	// Read back the output vectors of the first numVectors lanes. Bit j of
+	// the result for lane i is set if outputWires[j] is ONE in lane i:
+	vector< unsigned long long > getOutputVectors(const vector< IDType > &outputWires, unsigned long numVectors = VECTOR_LANES);
+
+private:
+	// Point the simulated gates' inputs and outputs back at nothing:
+	void releaseGates(void);
+
+	// Work out a net's state from the outputs driving it, and return
+	// whether it changed:
+	bool resolveNet(unsigned long net);
+
+	// Return the net that a wire is part of, or ID_NONE if it isn't compiled:
+	unsigned long getNet(IDType wireID);
+
+	Circuit* theCircuit;
+
+	// The input wires, in the order given to compile():
+	vector< IDType > inputWires;
+
+	// The compiled nets(the Circuit's junction groups), indexed by the
+	// junction group ID:
+	ID_MAP< IDType, unsigned long > netIndex;
+
+	// The state of each net, and whether it is an input net that is set
+	// from outside instead of by its drivers:
+	vector< VectorState > netStates;
+	vector< bool > inputNets;
+
+	// The states of the simulated gate outputs, and the outputs that drive
+	// each net, in CSR form: net n's outputs are
+	// outputStates[netDrivers[netDriverStart[n] .. netDriverStart[n+1] - 1]]:
+	vector< VectorState > outputStates;
+	vector< unsigned long > netDriverStart;
+	vector< unsigned long > netDrivers;
+
+	// The simulated gates, in the order to update them, and the nets that
+	// each one drives(gate i drives gateNets[gateNetStart[i] .. gateNetStart[i+1] - 1]):
+	//(The gates are held by counted pointers so that they can be released
+	// safely even if the Circuit has deleted them.)
+	vector< GATE_PTR > gateOrder;
+	vector< unsigned long > gateNetStart;
+	vector< unsigned long > gateNets;
+
+	// Where the gates that are in loops start in gateOrder:
+	unsigned long firstLoopGate;
+};
+
+#endif /*LOGIC_VECTOR_SIM_H_*/
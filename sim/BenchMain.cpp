@@ -0,0 +1,769 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   BenchMain: Main execution point of cedar-bench, which builds synthetic
+   circuits of any size and times the logic core on them
+*****************************************************************************/
+
+#include "../logic/logic_defaults.h"
+#include "../logic/logic_circuit.h"
+#include "../logic/logic_vector_sim.h"
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+
+#ifdef UNIX
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+// The wall clock time in seconds:
+static double wallTime(void) {
+#ifdef UNIX
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	return(double) now.tv_sec +(double) now.tv_usec / 1000000.0;
+#else
+	return(double) clock() /(double) CLOCKS_PER_SEC;
+#endif
+}
+
+// The peak resident set size of the process in kilobytes(0 if unknown):
+static long peakRSS(void) {
+#ifdef UNIX
+	struct rusage usage;
+	getrusage(RUSAGE_SELF, &usage);
+	return usage.ru_maxrss;
+#else
+	return 0;
+#endif
+}
+
+static string numberString(unsigned long number) {
+	ostringstream oss;
+	oss << number;
+	return oss.str();
+}
+
+// A benchmark circuit. build() makes the circuit through the Circuit API, and
+// stimulate() is called every getStimulusPeriod() timesteps while it runs, to
+// change its inputs:
+class BenchCase {
+public:
+	BenchCase() : cir(NULL), useBuses(true), nextGate(0), nextWire(0), seed(1) {};
+	virtual ~BenchCase() {};
+
+	virtual string getName(void) = 0;
+	virtual unsigned long getDefaultSize(void) = 0;
+	virtual void build(unsigned long size) = 0;
+
+	virtual TimeType getStimulusPeriod(void) { return 0; };
+	virtual void stimulate(unsigned long round) {};
+
+	// The combinational cases can also be run on input vectors(see
+	// --vectors), at getVectorSize(). They give their input and output
+	// wires, and can set the Circuit's inputs to a vector, to check the
+	// VectorSimulator against. The other cases return a size of 0:
+	virtual unsigned long getVectorSize(void) { return 0; };
+	virtual void getVectorWires(vector< IDType > &inputWires, vector< IDType > &outputWires) {};
+	virtual void setInputVector(unsigned long long inputVector) {};
+
+	void setCircuit(Circuit* newCircuit) { cir = newCircuit; };
+
+	// Whether the cases wire their multi-bit outputs as bus wires, or line
+	// by line. The lines get the same wire IDs either way:
+	void setUseBuses(bool newUseBuses) { useBuses = newUseBuses; };
+
+protected:
+	IDType newGate(string type) {
+		return cir->newGate(type, nextGate++);
+	};
+	IDType newWire(void) {
+		return cir->newWire(nextWire++);
+	};
+	void setParam(IDType gateID, string paramName, string value) {
+		cir->setGateParameter(gateID, paramName, value);
+	};
+	void setParam(IDType gateID, string paramName, unsigned long value) {
+		cir->setGateParameter(gateID, paramName, numberString(value));
+	};
+	IDType input(IDType gateID, string pinName, IDType wireID) {
+		cir->connectGateInput(gateID, pinName, wireID);
+		return wireID;
+	};
+	IDType output(IDType gateID, string pinName, IDType wireID) {
+		cir->connectGateOutput(gateID, pinName, wireID);
+		return wireID;
+	};
+
+	// A bus of wires, and the bus wire that they are the lines of(ID_NONE
+	// when the buses are off):
+	struct Bus {
+		IDType busID;
+		vector< IDType > lines;
+	};
+
+	// Drive a new bus from the outputs "busName_0" through "busName_x" of
+	// a gate, so that they send a bus event between them:
+	Bus outputBus(IDType gateID, string busName, unsigned long numLines) {
+		Bus newBus;
+		newBus.busID = ID_NONE;
+		if(useBuses) {
+			//(The bus's lines take the next wire IDs.)
+			newBus.busID = cir->newBusWire(numLines);
+			newBus.lines = cir->getBusLines(newBus.busID);
+			nextWire += numLines;
+			cir->connectGateOutputBus(gateID, busName, newBus.busID);
+		} else {
+			for(unsigned long i = 0; i < numLines; i++) {
+				newBus.lines.push_back(output(gateID, busName + "_" + numberString(i), newWire()));
+			}
+		}
+		return newBus;
+	};
+
+	// Connect the inputs "busName_0" through "busName_x" of a gate to a bus:
+	void inputBus(IDType gateID, string busName, const Bus &theBus) {
+		if(theBus.busID != ID_NONE) {
+			cir->connectGateInputBus(gateID, busName, theBus.busID);
+		} else {
+			for(unsigned long i = 0; i < theBus.lines.size(); i++) {
+				input(gateID, busName + "_" + numberString(i), theBus.lines[i]);
+			}
+		}
+	};
+
+	// A DRIVER with numBits outputs, whose wires are added to wires:
+	IDType newDriver(unsigned long numBits, unsigned long value, vector< IDType > *wires) {
+		IDType driver = newGate("DRIVER");
+		setParam(driver, "OUTPUT_BITS", numBits);
+		setParam(driver, "OUTPUT_NUM", value);
+		for(unsigned long i = 0; i < numBits; i++) {
+			IDType wireID = output(driver, "OUT_" + numberString(i), newWire());
+			if(wires != NULL) wires->push_back(wireID);
+		}
+		return driver;
+	};
+
+	// A DRIVER with numBits outputs, driving a bus:
+	Bus newBusDriver(unsigned long numBits, unsigned long value, IDType *driver) {
+		*driver = newGate("DRIVER");
+		setParam(*driver, "OUTPUT_BITS", numBits);
+		setParam(*driver, "OUTPUT_NUM", value);
+		return outputBus(*driver, "OUT", numBits);
+	};
+
+	// A CLOCK, returning its output wire:
+	IDType newClock(unsigned long halfCycle) {
+		IDType clock = newGate("CLOCK");
+		setParam(clock, "HALF_CYCLE", halfCycle);
+		return output(clock, "CLK", newWire());
+	};
+
+	// A repeatable pseudo-random number, so that every run is the same:
+	unsigned long random(void) {
+		seed = seed * 1103515245 + 12345;
+		return(seed >> 16) & 0x7FFF;
+	};
+
+	Circuit* cir;
+	bool useBuses;
+	IDType nextGate;
+	IDType nextWire;
+	unsigned long seed;
+};
+
+// An N-bit ripple-carry adder made from XOR, AND and OR gates, with new
+// random operands every 64 timesteps:
+class AdderBench : public BenchCase {
+public:
+	string getName(void) { return "adder"; };
+	unsigned long getDefaultSize(void) { return 256; };
+
+	void build(unsigned long size) {
+		vector< IDType > a, b;
+		for(unsigned long i = 0; i < size; i += DRIVER_BITS) {
+			drivers.push_back(newDriver(DRIVER_BITS, 0, &a));
+			drivers.push_back(newDriver(DRIVER_BITS, 0, &b));
+		}
+		vector< IDType > carryIn;
+		carryDriver = newDriver(1, 0, &carryIn);
+		IDType carryWire = carryIn[0];
+
+		// The inputs for the vectors are all of the driven bits of a and b
+		// and the carry in, and the outputs are the sum and the carry out:
+		inputBits = a.size();
+		inputWires = a;
+		inputWires.insert(inputWires.end(), b.begin(), b.end());
+		inputWires.push_back(carryWire);
+		outputWires.clear();
+
+		for(unsigned long i = 0; i < size; i++) {
+			// sum = a ^ b ^ carry, carry = (a & b) | (carry & (a ^ b)):
+			IDType halfSum = newWire();
+			IDType gate = newGate("XOR");
+			setParam(gate, "INPUT_BITS", 2);
+			input(gate, "IN_0", a[i]);
+			input(gate, "IN_1", b[i]);
+			output(gate, "OUT", halfSum);
+
+			gate = newGate("XOR");
+			setParam(gate, "INPUT_BITS", 2);
+			input(gate, "IN_0", halfSum);
+			input(gate, "IN_1", carryWire);
+			outputWires.push_back(output(gate, "OUT", newWire()));
+
+			IDType bothSet = newWire();
+			gate = newGate("AND");
+			setParam(gate, "INPUT_BITS", 2);
+			input(gate, "IN_0", a[i]);
+			input(gate, "IN_1", b[i]);
+			output(gate, "OUT", bothSet);
+
+			IDType carrySet = newWire();
+			gate = newGate("AND");
+			setParam(gate, "INPUT_BITS", 2);
+			input(gate, "IN_0", halfSum);
+			input(gate, "IN_1", carryWire);
+			output(gate, "OUT", carrySet);
+
+			carryWire = newWire();
+			gate = newGate("OR");
+			setParam(gate, "INPUT_BITS", 2);
+			input(gate, "IN_0", bothSet);
+			input(gate, "IN_1", carrySet);
+			output(gate, "OUT", carryWire);
+		}
+		outputWires.push_back(carryWire);
+	};
+
+	TimeType getStimulusPeriod(void) { return 64; };
+	void stimulate(unsigned long round) {
+		for(unsigned long i = 0; i < drivers.size(); i++) {
+			setParam(drivers[i], "OUTPUT_NUM", random() &((1 << DRIVER_BITS) - 1));
+		}
+	};
+
+	// 24 bits, which is 49 inputs:
+	unsigned long getVectorSize(void) { return 24; };
+	void getVectorWires(vector< IDType > &newInputWires, vector< IDType > &newOutputWires) {
+		newInputWires = inputWires;
+		newOutputWires = outputWires;
+	};
+	void setInputVector(unsigned long long inputVector) {
+		for(unsigned long i = 0; i < drivers.size(); i += 2) {
+			unsigned long shift = i / 2 * DRIVER_BITS;
+			setParam(drivers[i], "OUTPUT_NUM",(inputVector >> shift) &((1 << DRIVER_BITS) - 1));
+			setParam(drivers[i + 1], "OUTPUT_NUM",(inputVector >>(inputBits + shift)) &((1 << DRIVER_BITS) - 1));
+		}
+		setParam(carryDriver, "OUTPUT_NUM",(inputVector >>(2 * inputBits)) & 1);
+	};
+
+private:
+	enum { DRIVER_BITS = 8 };
+	vector< IDType > drivers;
+	IDType carryDriver;
+	unsigned long inputBits; // The driven bits of a and of b.
+	vector< IDType > inputWires;
+	vector< IDType > outputWires;
+};
+
+// Ripple counters of 16 JKFFs each, N flip-flops in all, all on one clock:
+class CounterBench : public BenchCase {
+public:
+	string getName(void) { return "counter"; };
+	unsigned long getDefaultSize(void) { return 1024; };
+
+	void build(unsigned long size) {
+		vector< IDType > high;
+		newDriver(1, 1, &high);
+		IDType clock = newClock(1);
+
+		IDType stageClock = clock;
+		for(unsigned long i = 0; i < size; i++) {
+			if(i % 16 == 0) stageClock = clock;
+			IDType flipFlop = newGate("JKFF");
+			input(flipFlop, "J", high[0]);
+			input(flipFlop, "K", high[0]);
+			input(flipFlop, "clock", stageClock);
+			output(flipFlop, "Q", newWire());
+			stageClock = output(flipFlop, "nQ", newWire());
+		}
+	};
+};
+
+// RAMs with 8 address and 8 data bits, being written and read at random
+// addresses as fast as their clock goes. The addresses and data go over bus
+// wires:
+class RamBench : public BenchCase {
+public:
+	string getName(void) { return "ram"; };
+	unsigned long getDefaultSize(void) { return 16; };
+
+	void build(unsigned long size) {
+		IDType clock = newClock(1);
+		for(unsigned long i = 0; i < size; i++) {
+			IDType addressDriver, dataDriver;
+			Bus address = newBusDriver(8, 0, &addressDriver);
+			Bus data = newBusDriver(8, 0, &dataDriver);
+			drivers.push_back(addressDriver);
+			drivers.push_back(dataDriver);
+			vector< IDType > writeEnable;
+			enables.push_back(newDriver(1, 0, &writeEnable));
+
+			IDType ram = newGate("RAM");
+			setParam(ram, "ADDRESS_BITS", 8);
+			setParam(ram, "DATA_BITS", 8);
+			input(ram, "write_clock", clock);
+			input(ram, "write_enable", writeEnable[0]);
+			inputBus(ram, "ADDRESS", address);
+			inputBus(ram, "DATA_IN", data);
+			outputBus(ram, "DATA_OUT", 8);
+		}
+	};
+
+	// New addresses and data every clock cycle, writing for 8 cycles and
+	// then reading for 8:
+	TimeType getStimulusPeriod(void) { return 2; };
+	void stimulate(unsigned long round) {
+		for(unsigned long i = 0; i < drivers.size(); i++) {
+			setParam(drivers[i], "OUTPUT_NUM", random() & 0xFF);
+		}
+		if(round % 8 == 0) {
+			for(unsigned long i = 0; i < enables.size(); i++) {
+				setParam(enables[i], "OUTPUT_NUM",(round / 8) % 2);
+			}
+		}
+	};
+
+private:
+	vector< IDType > drivers;
+	vector< IDType > enables;
+};
+
+// An N by N mesh of XOR gates that only talk through FROM/TO junctions: each
+// cell reads its left and upper neighbors' named links and drives its own.
+// The top row and left column are driven by two clocks:
+class MeshBench : public BenchCase {
+public:
+	string getName(void) { return "mesh"; };
+	unsigned long getDefaultSize(void) { return 32; };
+
+	void build(unsigned long size) {
+		link(newClock(7), "row");
+		link(newClock(11), "column");
+
+		for(unsigned long y = 0; y < size; y++) {
+			for(unsigned long x = 0; x < size; x++) {
+				IDType cell = newGate("XOR");
+				setParam(cell, "INPUT_BITS", 2);
+				input(cell, "IN_0", from((x == 0) ? "row" : cellName(x - 1, y)));
+				input(cell, "IN_1", from((y == 0) ? "column" : cellName(x, y - 1)));
+				link(output(cell, "OUT", newWire()), cellName(x, y));
+			}
+		}
+	};
+
+private:
+	string cellName(unsigned long x, unsigned long y) {
+		return "c" + numberString(x) + "_" + numberString(y);
+	};
+
+	// Tie a wire to a named link with a TO gate:
+	void link(IDType wireID, string name) {
+		IDType to = newGate("TO");
+		setParam(to, "JUNCTION_ID", name);
+		input(to, "IN_0", wireID);
+	};
+
+	// Make a new wire that reads a named link with a FROM gate:
+	IDType from(string name) {
+		IDType fromGate = newGate("FROM");
+		setParam(fromGate, "JUNCTION_ID", name);
+		return input(fromGate, "IN_0", newWire());
+	};
+};
+
+// Z80s, each running a tight loop out of its own RAM, over an address bus
+// and a data bus:
+class Z80Bench : public BenchCase {
+public:
+	string getName(void) { return "z80"; };
+	unsigned long getDefaultSize(void) { return 1; };
+
+	void build(unsigned long size) {
+		vector< IDType > power, ground, high;
+		newDriver(1, 1, &power);
+		newDriver(1, 0, &ground);
+		newDriver(1, 1, &high);
+		IDType clock = newClock(1);
+
+		for(unsigned long i = 0; i < size; i++) {
+			IDType z80 = newGate("Z80");
+			setParam(z80, "ZAD_MODE", "OFF");
+			input(z80, "CLK", clock);
+			input(z80, "VCC", power[0]);
+			input(z80, "GND", ground[0]);
+			input(z80, "/RESET", high[0]);
+			input(z80, "/WAIT", high[0]);
+			input(z80, "/INT", high[0]);
+			input(z80, "/NMI", high[0]);
+			input(z80, "/BUSREQ", high[0]);
+
+			// The RAM only ever reads:
+			IDType ram = newGate("RAM");
+			setParam(ram, "ADDRESS_BITS", 8);
+			setParam(ram, "DATA_BITS", 8);
+			input(ram, "write_clock", clock);
+			input(ram, "write_enable", ground[0]);
+			//(The RAM only uses the low 8 of the 16 address lines.)
+			Bus address = outputBus(z80, "A", 16);
+			for(unsigned long bit = 0; bit < 8; bit++) {
+				input(ram, "ADDRESS_" + numberString(bit), address.lines[bit]);
+			}
+			inputBus(z80, "D_IN", outputBus(ram, "DATA_OUT", 8));
+
+			// loop: INC A; INC B; LD C,A; JP loop
+			const unsigned long program[] = { 0x3C, 0x04, 0x4F, 0xC3, 0x00, 0x00 };
+			for(unsigned long address = 0; address < sizeof(program) / sizeof(program[0]); address++) {
+				setParam(ram, "Address:" + numberString(address), program[address]);
+			}
+		}
+	};
+};
+
+// How the benchmarks are run:
+struct BenchOptions {
+	unsigned long size; // 0 for each case's default.
+	TimeType ticks;
+	EngineType engine;
+	unsigned long partitions;
+	unsigned long threads;
+	bool buses;
+	unsigned long vectors; // 0 to step the cases instead.
+	bool check;
+	vector< string > caseNames;
+};
+
+static void usage(void) {
+	cerr << "usage: cedar-bench [options] [case ...]" << endl
+		<< "  cases: adder, counter, ram, mesh, z80(default all of them)" << endl
+		<< "  -n, --size N           the size of each circuit(bits, flip-flops," << endl
+		<< "                         RAMs, mesh width or Z80s)" << endl
+		<< "  -t, --ticks N          run each circuit for N timesteps(default 10000)" << endl
+		<< "  -e, --engine NAME      event(default) or levelized" << endl
+		<< "  -p, --partitions N     run the event engine in N partitions" << endl
+		<< "  -j, --threads N        use N threads" << endl
+		<< "  -l, --lines            wire the buses line by line, instead of as bus" << endl
+		<< "                         wires" << endl
+		<< "  -v, --vectors N        run N input vectors through the combinational" << endl
+		<< "                         cases(adder) with the VectorSimulator" << endl
+		<< "  -c, --check            instead of timing the cases, check that every" << endl
+		<< "                         wire and parameter change matches a run on one" << endl
+		<< "                         partition and thread, with the buses wired line" << endl
+		<< "                         by line. With --vectors, check every vector's" << endl
+		<< "                         outputs against stepping the circuit" << endl;
+}
+
+static BenchCase* newBenchCase(string name) {
+	if(name == "adder") return new AdderBench();
+	if(name == "counter") return new CounterBench();
+	if(name == "ram") return new RamBench();
+	if(name == "mesh") return new MeshBench();
+	if(name == "z80") return new Z80Bench();
+	return NULL;
+}
+
+// Build a benchmark's circuit and run it, logging its changes to changeLog
+// if it isn't NULL. Returns the Circuit, and whether any of the run was
+// partitioned:
+static Circuit* buildAndRun(BenchCase* theCase, const BenchOptions &options, vector< LoggedChange >* changeLog,
+							double &buildTime, double &runTime, bool &partitioned) {
+	unsigned long size =(options.size == 0) ? theCase->getDefaultSize() : options.size;
+	Circuit* cir = new Circuit();
+	theCase->setCircuit(cir);
+	theCase->setUseBuses(options.buses);
+	cir->setEngine(options.engine);
+	cir->setThreadCount(options.threads);
+	cir->setPartitionCount(options.partitions);
+	cir->setChangeLog(changeLog);
+
+	double buildStart = wallTime();
+	theCase->build(size);
+	buildTime = wallTime() - buildStart;
+
+	double runStart = wallTime();
+	partitioned = false;
+	TimeType period = theCase->getStimulusPeriod();
+	if(period == 0) {
+		cir->runUntil(options.ticks);
+		partitioned = cir->ranPartitioned();
+	} else {
+		for(unsigned long round = 0; cir->getSystemTime() < options.ticks; round++) {
+			theCase->stimulate(round);
+			cir->runUntil(min(cir->getSystemTime() + period, options.ticks));
+			partitioned = partitioned || cir->ranPartitioned();
+			cir->clearParamUpdateList();
+		}
+	}
+	runTime = wallTime() - runStart;
+	if(runTime <= 0) runTime = 1e-9;
+	return cir;
+}
+
+// Build and run one benchmark, and print its line of results:
+static void runBenchCase(BenchCase* theCase, const BenchOptions &options) {
+	unsigned long size =(options.size == 0) ? theCase->getDefaultSize() : options.size;
+	double buildTime, runTime;
+	bool partitioned;
+	Circuit* cir = buildAndRun(theCase, options, NULL, buildTime, runTime, partitioned);
+
+	unsigned long long events = cir->getEventCount();
+	unsigned long long updates = cir->getGateUpdateCount();
+	cout << theCase->getName() << "\t" << size << "\t" << options.ticks << "\t"
+		<< buildTime << "\t" << runTime << "\t"
+		<< events << "\t" <<(unsigned long long)(events / runTime) << "\t"
+		<< updates << "\t" <<(unsigned long long)(updates / runTime) << "\t"
+		<< peakRSS() << endl;
+	delete cir;
+}
+
+// Run one benchmark with the options and then on one partition and thread
+// with the buses wired line by line, and print whether every wire and
+// parameter change was the same, timestep by timestep. Returns false if they
+// weren't:
+static bool checkBenchCase(string caseName, const BenchOptions &options) {
+	BenchOptions referenceOptions = options;
+	referenceOptions.partitions = 1;
+	referenceOptions.threads = 1;
+	referenceOptions.buses = false;
+
+	double buildTime, runTime;
+	bool partitioned, referencePartitioned;
+	vector< LoggedChange > changeLog, referenceLog;
+	BenchCase* theCase = newBenchCase(caseName);
+	delete buildAndRun(theCase, options, &changeLog, buildTime, runTime, partitioned);
+	delete theCase;
+	theCase = newBenchCase(caseName);
+	delete buildAndRun(theCase, referenceOptions, &referenceLog, buildTime, runTime, referencePartitioned);
+	delete theCase;
+
+	unsigned long differences = compareChangeLogs(changeLog, referenceLog, cerr, 10);
+	cout << caseName << "\t" << changeLog.size() << "\t" <<(partitioned ? "yes" : "no") << "\t"
+		<<((differences == 0) ? "passed" : "failed") << endl;
+	return(differences == 0);
+}
+
+// Run input vectors through a combinational benchmark with the
+// VectorSimulator, and print its line of results. With --check, each vector
+// is also set on the inputs of a Circuit that is stepped until nothing is
+// left to happen, and its outputs are checked against the vector's lane.
+// Returns false if any of them didn't match:
+static bool runVectorCase(string caseName, const BenchOptions &options) {
+	BenchCase* theCase = newBenchCase(caseName);
+	unsigned long size =(options.size == 0) ? theCase->getVectorSize() : options.size;
+	Circuit* cir = new Circuit();
+	theCase->setCircuit(cir);
+	theCase->build(size);
+	vector< IDType > inputWires, outputWires;
+	theCase->getVectorWires(inputWires, outputWires);
+	if(inputWires.empty() || inputWires.size() > 64 || outputWires.size() > 64) {
+		cerr << "cedar-bench: a vector can only have 64 inputs and 64 outputs(" << caseName << " has "
+			<< inputWires.size() << " and " << outputWires.size() << ")" << endl;
+		delete cir;
+		delete theCase;
+		return false;
+	}
+
+	// Repeatable pseudo-random vectors:
+	vector< unsigned long long > vectors;
+	unsigned long long seed = 1;
+	for(unsigned long i = 0; i < options.vectors; i++) {
+		seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+		vectors.push_back(seed >>(64 - inputWires.size()));
+	}
+
+	double runStart = wallTime();
+	vector< unsigned long long > results;
+	VectorSimulator* vsim = new VectorSimulator(cir);
+	bool compiled = vsim->compile(inputWires);
+	for(unsigned long first = 0; compiled && first < vectors.size(); first += VECTOR_LANES) {
+		vector< unsigned long long > batch(vectors.begin() + first, vectors.begin() + min(first + VECTOR_LANES,(unsigned long) vectors.size()));
+		vsim->loadInputVectors(batch);
+		vsim->evaluate();
+		vector< unsigned long long > batchResults = vsim->getOutputVectors(outputWires, batch.size());
+		results.insert(results.end(), batchResults.begin(), batchResults.end());
+	}
+	double runTime = wallTime() - runStart;
+	if(runTime <= 0) runTime = 1e-9;
+	delete vsim;
+	if(!compiled) cerr << "cedar-bench: " << caseName << " has gates that can't be run on vectors" << endl;
+
+	// Step the circuit through the same vectors:
+	unsigned long mismatches = 0;
+	if(compiled && options.check) {
+		for(unsigned long i = 0; i < vectors.size(); i++) {
+			theCase->setInputVector(vectors[i]);
+			TimeType nextActive;
+			while((nextActive = cir->getNextActiveTime()) != TIME_NONE) cir->runUntil(nextActive + 1);
+			cir->clearParamUpdateList();
+
+			unsigned long long stepped = 0;
+			for(unsigned long j = 0; j < outputWires.size(); j++) {
+				if(cir->getWireState(outputWires[j]) == ONE) stepped |= 1ULL << j;
+			}
+			if(stepped == results[i]) continue;
+			if(mismatches++ < 10) {
+				cerr << hex << "vector 0x" << vectors[i] << ": 0x" << results[i] << " in lane " << dec << i % VECTOR_LANES
+					<< hex << ", but 0x" << stepped << " stepped" << dec << endl;
+			}
+		}
+	}
+
+	cout << caseName << "\t" << size << "\t" << vectors.size() << "\t" << runTime << "\t"
+		<<(unsigned long long)(vectors.size() / runTime) << "\t"
+		<<(!options.check ? "-" :((compiled && mismatches == 0) ? "passed" : "failed")) << endl;
+	delete cir;
+	delete theCase;
+	return compiled && mismatches == 0;
+}
+
+int main(int argc, char** argv) {
+	BenchOptions options;
+	options.size = 0;
+	options.ticks = 10000;
+	options.engine = ENGINE_EVENT;
+	options.partitions = 1;
+	options.threads = 1;
+	options.buses = true;
+	options.vectors = 0;
+	options.check = false;
+
+	for(int i = 1; i < argc; i++) {
+		string arg = argv[i];
+		if(arg[0] != '-') {
+			options.caseNames.push_back(arg);
+			continue;
+		}
+		if((arg == "-c") || (arg == "--check")) {
+			options.check = true;
+			continue;
+		}
+		if((arg == "-l") || (arg == "--lines")) {
+			options.buses = false;
+			continue;
+		}
+		if(i + 1 >= argc) {
+			usage();
+			return 1;
+		}
+		istringstream iss(argv[++i]);
+		bool valid = true;
+		if((arg == "-n") || (arg == "--size")) {
+			iss >> options.size;
+			valid = !iss.fail();
+		} else if((arg == "-t") || (arg == "--ticks")) {
+			iss >> options.ticks;
+			valid = !iss.fail();
+		} else if((arg == "-e") || (arg == "--engine")) {
+			if(iss.str() == "event") options.engine = ENGINE_EVENT;
+			else if(iss.str() == "levelized") options.engine = ENGINE_LEVELIZED;
+			else valid = false;
+		} else if((arg == "-p") || (arg == "--partitions")) {
+			iss >> options.partitions;
+			valid = !iss.fail() && options.partitions > 0;
+		} else if((arg == "-j") || (arg == "--threads")) {
+			iss >> options.threads;
+			valid = !iss.fail() && options.threads > 0;
+		} else if((arg == "-v") || (arg == "--vectors")) {
+			iss >> options.vectors;
+			valid = !iss.fail() && options.vectors > 0;
+		} else {
+			valid = false;
+		}
+		if(!valid) {
+			usage();
+			return 1;
+		}
+	}
+	bool namedCases = !options.caseNames.empty();
+	if(!namedCases) {
+		const char* allCases[] = { "adder", "counter", "ram", "mesh", "z80" };
+		options.caseNames.assign(allCases, allCases + 5);
+	}
+	for(unsigned long i = 0; i < options.caseNames.size(); i++) {
+		BenchCase* theCase = newBenchCase(options.caseNames[i]);
+		if(theCase == NULL) {
+			cerr << "cedar-bench: there is no case " << options.caseNames[i] << endl;
+			usage();
+			return 1;
+		}
+		delete theCase;
+	}
+
+	// Run the vectors through the combinational cases instead:
+	if(options.vectors > 0) {
+		cout << "case\tsize\tvectors\trun_sec\tvectors_per_sec\tcheck" << endl;
+		int result = 0;
+		for(unsigned long i = 0; i < options.caseNames.size(); i++) {
+			BenchCase* theCase = newBenchCase(options.caseNames[i]);
+			bool hasVectors =(theCase->getVectorSize() > 0);
+			delete theCase;
+			if(!hasVectors) {
+				if(namedCases) cerr << "cedar-bench: " << options.caseNames[i] << " can't be run on vectors" << endl;
+				continue;
+			}
+			if(!runVectorCase(options.caseNames[i], options)) result = 2;
+		}
+		return result;
+	}
+
+	// Check the cases instead, with a line for each:
+	if(options.check) {
+		cout << "case\tchanges\tpartitioned\tcheck" << endl;
+		int result = 0;
+		for(unsigned long i = 0; i < options.caseNames.size(); i++) {
+			if(!checkBenchCase(options.caseNames[i], options)) result = 2;
+		}
+		return result;
+	}
+
+	// One tab-separated line per case:
+	cout << "case\tsize\tticks\tbuild_sec\trun_sec\tevents\tevents_per_sec"
+		<< "\tgate_updates\tgate_updates_per_sec\tpeak_rss_kb" << endl;
+	for(unsigned long i = 0; i < options.caseNames.size(); i++) {
+		BenchCase* theCase = newBenchCase(options.caseNames[i]);
+#ifdef UNIX
+		// Run each case in its own process, so that the peak RSS is its own:
+		cout.flush();
+		pid_t child = fork();
+		if(child == 0) {
+			runBenchCase(theCase, options);
+			cout.flush();
+			_exit(0);
+		}
+		if(child > 0) {
+			int status = 0;
+			waitpid(child, &status, 0);
+		} else {
+			runBenchCase(theCase, options);
+		}
+#else
+		runBenchCase(theCase, options);
+#endif
+		delete theCase;
+	}
+	return 0;
+}
@@ -0,0 +1,243 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   CircuitLoader: Loads a user circuit file straight into a logic Circuit,
+   without the GUI
+*****************************************************************************/
+
+#include "CircuitLoader.h"
+#include <tinyxml2.h>
+#include <fstream>
+#include <sstream>
+
+using namespace tinyxml2;
+
+CircuitLoader::CircuitLoader() {
+	return;
+}
+
+CircuitLoader::~CircuitLoader() {
+	return;
+}
+
+/* The same macro as in LibraryParse */
+#define FOREACH_ELEMENT(var, parent, name)				\
+	for(XMLElement *var =(parent)->FirstChildElement(name);	\
+	    var != NULL;						\
+	    var = var->NextSiblingElement(name))
+
+// Read a library file:
+bool CircuitLoader::loadLibrary(string fileName) {
+	XMLDocument doc;
+	if(doc.LoadFile(fileName.c_str()) != XML_SUCCESS) return false;
+	XMLElement *libs = doc.FirstChildElement("libraries");
+	if(libs == NULL) return false;
+
+	FOREACH_ELEMENT(lib, libs, "library") {
+		FOREACH_ELEMENT(g, lib, "gate") {
+			XMLElement *tmp = g->FirstChildElement("name");
+			if((tmp == NULL) || (tmp->GetText() == NULL)) continue;
+			SimLibraryGate &lg = libraryGates[tmp->GetText()];
+
+			if(((tmp = g->FirstChildElement("logic_type")) != NULL) && (tmp->GetText() != NULL)) {
+				lg.logicType = tmp->GetText();
+			}
+			FOREACH_ELEMENT(param, g, "logic_param") {
+				if(param->GetText() == NULL) continue;
+				string name, value;
+				istringstream iss(param->GetText());
+				iss >> name >> value;
+				lg.logicParams[name] = value;
+			}
+
+			// The hotspots(the inputs come first, as in LibraryParse):
+			for(int pass = 0; pass < 2; pass++) {
+				FOREACH_ELEMENT(node, g, (pass == 0) ? "input" : "output") {
+					SimLibraryGate::Hotspot hs;
+					hs.isInput =(pass == 0);
+					hs.isInverted = false;
+					FOREACH_ELEMENT(n, node, NULL) {
+						string tagName(n->Value());
+						string text =(n->GetText() != NULL) ? n->GetText() : "";
+						if(tagName == "name") hs.name = text;
+						else if(tagName == "inverted") hs.isInverted =(text == "true");
+						else if(tagName == "enable_input" || tagName == "enable_output") hs.logicEInput = text;
+					}
+					lg.hotspots.push_back(hs);
+				}
+			}
+		}
+	}
+	return true;
+}
+
+// Build the circuit in a .cdl file into theCircuit:
+//(This follows CircuitParse::parseFile().)
+bool CircuitLoader::loadCircuit(string fileName, Circuit* theCircuit) {
+	fstream x(fileName.c_str(), ios::in);
+	if(!x) return false;
+	XMLParser* mParse = new XMLParser(&x, false);
+
+	gateIDs.clear();
+	wireIDs.clear();
+	wireIDSet.clear();
+	namedWires.clear();
+	warnings.clear();
+
+	if(mParse->readTag() != "circuit") {
+		delete mParse;
+		return false;
+	}
+
+	// Read the currentPage tag:
+	string temp = mParse->readTag();
+	if(temp == "CurrentPage") {
+		mParse->readCloseTag();
+		temp = mParse->readTag();
+	}
+
+	// Every tag in the circuit is a page:
+	while(temp != "" && !mParse->is_eof()) {
+		while(!mParse->isCloseTag(mParse->getCurrentIndex()) && !mParse->is_eof()) {
+			temp = mParse->readTag();
+			if(temp == "gate") {
+				FileGate theGate;
+				parseGate(mParse, theGate);
+				buildGate(theGate, theCircuit);
+			} else if(temp != "") {
+				// The viewport and the wires' shapes:
+				skipTag(mParse);
+			}
+		}
+		mParse->readCloseTag(); // >page
+		temp = mParse->readTag();
+	}
+
+	delete mParse;
+	return true;
+}
+
+// Read a <gate> tag's contents from the circuit file:
+void CircuitLoader::parseGate(XMLParser* mParse, FileGate &theGate) {
+	theGate.id = ID_NONE;
+	do { // get full gate structure
+		string temp = mParse->readTag(); // get tag
+		if(temp == "ID") {
+			istringstream iss(mParse->readTagValue(temp));
+			iss >> theGate.id;
+		} else if(temp == "type") {
+			theGate.type = mParse->readTagValue(temp);
+
+			// The gate types that were dropped are replaced, as in
+			// CircuitParse::parseFile():
+			if(theGate.type == "AM_RAM_16x16_Single_Port") {
+				theGate.type = "AM_RAM_16x16";
+			} else if(theGate.type == "AA_DFF") {
+				theGate.type = "AE_DFF_LOW";
+			} else if(theGate.type == "BA_JKFF") {
+				theGate.type = "BE_JKFF_LOW";
+			} else if(theGate.type == "BA_JKFF_NT") {
+				theGate.type = "BE_JKFF_LOW_NT";
+			}
+		} else if(temp == "input" || temp == "output") {
+			mParse->readTag(); // get connection ID
+			string connectionID = mParse->readTagValue("ID");
+			mParse->readCloseTag();
+			IDType wireID = ID_NONE;
+			istringstream iss(mParse->readTagValue(temp));
+			iss >> wireID;
+			if(temp == "input") theGate.inputs.push_back(make_pair(connectionID, wireID));
+			else theGate.outputs.push_back(make_pair(connectionID, wireID));
+		} else if(temp == "lparam") {
+			string paramData = mParse->readTagValue(temp);
+			string name, value;
+			istringstream iss(paramData);
+			iss >> name;
+			getline(iss, value, '\n');
+			theGate.logicParams.push_back(make_pair(name,(value.size() > 0) ? value.substr(1) : value));
+		}
+		//(The gparams are only for the GUI.)
+		mParse->readCloseTag(); // </>
+	} while(!mParse->isCloseTag(mParse->getCurrentIndex()) && !mParse->is_eof());
+	mParse->readCloseTag(); // >gate
+}
+
+// Skip over the contents of a tag and its close tag:
+void CircuitLoader::skipTag(XMLParser* mParse) {
+	unsigned long depth = 1;
+	while(depth > 0 && !mParse->is_eof()) {
+		if(mParse->readTag() == "") {
+			// A close tag is next:
+			mParse->readCloseTag();
+			depth--;
+		} else {
+			depth++;
+		}
+	}
+}
+
+// Make a gate in the Circuit, sending it what CircuitParse::parseGateToSend()
+// sends to the core:
+void CircuitLoader::buildGate(const FileGate &theGate, Circuit* theCircuit) {
+	map < string, SimLibraryGate >::iterator findGate = libraryGates.find(theGate.type);
+	if(findGate == libraryGates.end()) {
+		warnings.push_back("gate type " + theGate.type + " is not in the library");
+		return;
+	}
+	SimLibraryGate &libGate = findGate->second;
+	if(libGate.logicType.size() == 0) return;
+
+	theCircuit->newGate(libGate.logicType, theGate.id);
+	gateIDs.push_back(theGate.id);
+
+	// The library's parameters first, and then the file's:
+	//(The GUI saves every logic parameter of a gate, including the library
+	// ones, so the file's take over.)
+	map < string, string >::iterator paramWalk = libGate.logicParams.begin();
+	while(paramWalk != libGate.logicParams.end()) {
+		theCircuit->setGateParameter(theGate.id, paramWalk->first, paramWalk->second);
+		paramWalk++;
+	}
+	string junctionName = libGate.logicParams["JUNCTION_ID"];
+	for(unsigned long i = 0; i < theGate.logicParams.size(); i++) {
+		theCircuit->setGateParameter(theGate.id, theGate.logicParams[i].first, theGate.logicParams[i].second);
+		if(theGate.logicParams[i].first == "JUNCTION_ID") junctionName = theGate.logicParams[i].second;
+	}
+
+	// The hotspot settings:
+	for(unsigned long i = 0; i < libGate.hotspots.size(); i++) {
+		SimLibraryGate::Hotspot &hs = libGate.hotspots[i];
+		if(hs.isInverted) {
+			if(hs.isInput) theCircuit->setGateInputParameter(theGate.id, hs.name, "INVERTED", "TRUE");
+			else theCircuit->setGateOutputParameter(theGate.id, hs.name, "INVERTED", "TRUE");
+		}
+		if(hs.logicEInput != "") {
+			if(hs.isInput) theCircuit->setGateInputParameter(theGate.id, hs.name, "E_INPUT", hs.logicEInput);
+			else theCircuit->setGateOutputParameter(theGate.id, hs.name, "E_INPUT", hs.logicEInput);
+		}
+	}
+
+	// The connections, which make the wires:
+	for(unsigned long i = 0; i < theGate.inputs.size(); i++) {
+		IDType wireID = theGate.inputs[i].second;
+		theCircuit->connectGateInput(theGate.id, theGate.inputs[i].first, wireID);
+		if(wireIDSet.insert(wireID).second) wireIDs.push_back(wireID);
+		if(libGate.logicType == "TO" && junctionName != "") namedWires[junctionName] = wireID;
+	}
+	for(unsigned long i = 0; i < theGate.outputs.size(); i++) {
+		IDType wireID = theGate.outputs[i].second;
+		theCircuit->connectGateOutput(theGate.id, theGate.outputs[i].first, wireID);
+		if(wireIDSet.insert(wireID).second) wireIDs.push_back(wireID);
+	}
+}
+
+// Find the wire going into the TO gate with the JUNCTION_ID name:
+IDType CircuitLoader::findNamedWire(string name) {
+	map < string, IDType >::iterator findWire = namedWires.find(name);
+	if(findWire == namedWires.end()) return ID_NONE;
+	return findWire->second;
+}
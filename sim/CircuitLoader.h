@@ -0,0 +1,102 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   CircuitLoader: Loads a user circuit file straight into a logic Circuit,
+   without the GUI
+*****************************************************************************/
+
+#ifndef CIRCUITLOADER_H_
+#define CIRCUITLOADER_H_
+
+#include "../GUI/XMLParser.h"
+#include "../logic/logic_defaults.h"
+#include "../logic/logic_circuit.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+
+using namespace std;
+
+// The parts of a library gate that the logic core needs:
+struct SimLibraryGate {
+	string logicType; // "" for the gates that are only drawn, like text.
+	map < string, string > logicParams;
+
+	// The hotspots' "INVERTED" and "E_INPUT" settings, as sent to the core
+	// by CircuitParse::parseGateToSend():
+	struct Hotspot {
+		string name;
+		bool isInput;
+		bool isInverted;
+		string logicEInput;
+	};
+	vector < Hotspot > hotspots;
+};
+
+// CircuitLoader reads a gate library and a .cdl circuit file, and builds the
+// circuit in a logic Circuit the same way that CircuitParse and threadLogic do
+// between them for the GUI. It doesn't use wxWidgets, so that circuits can be
+// run headless(see cedar-sim).
+//
+// The library is read with tinyxml2, like LibraryParse. The circuit file isn't
+// proper XML(the pages are tagged "<page 0>"), so it is read with the GUI's
+// own XMLParser. Only the gates are needed: the wires are made by the gates'
+// connections, and their shapes are skipped.
+class CircuitLoader {
+public:
+	CircuitLoader();
+	virtual ~CircuitLoader();
+
+	// Read a library file. Returns false if it can't be read:
+	bool loadLibrary(string fileName);
+
+	// Build the circuit in a .cdl file into theCircuit, which should be
+	// empty. Returns false if the file can't be read:
+	bool loadCircuit(string fileName, Circuit* theCircuit);
+
+	// The gates and wires made by the last loadCircuit():
+	const vector < IDType >& getGateIDs(void) { return gateIDs; };
+	const vector < IDType >& getWireIDs(void) { return wireIDs; };
+
+	// Find the wire going into the TO gate with the JUNCTION_ID name, which is
+	// how the oscilloscope names its wires. Returns ID_NONE if there isn't one:
+	IDType findNamedWire(string name);
+
+	// The warnings for the gates that couldn't be made:
+	const vector < string >& getWarnings(void) { return warnings; };
+
+private:
+	// A gate read from the circuit file:
+	struct FileGate {
+		string type;
+		IDType id;
+		vector < pair < string, IDType > > inputs;
+		vector < pair < string, IDType > > outputs;
+		vector < pair < string, string > > logicParams;
+	};
+
+	// Read a <gate> tag's contents from the circuit file:
+	void parseGate(XMLParser* mParse, FileGate &theGate);
+
+	// Skip over the contents of a tag and its close tag:
+	void skipTag(XMLParser* mParse);
+
+	// Make a gate in the Circuit:
+	void buildGate(const FileGate &theGate, Circuit* theCircuit);
+
+	// The library gates by name:
+	map < string, SimLibraryGate > libraryGates;
+
+	vector < IDType > gateIDs;
+	vector < IDType > wireIDs;
+	set < IDType > wireIDSet;
+	map < string, IDType > namedWires;
+	vector < string > warnings;
+};
+
+#endif /*CIRCUITLOADER_H_*/
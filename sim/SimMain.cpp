@@ -0,0 +1,468 @@
+/*****************************************************************************
+   Project: CEDAR Logic Simulator
+   Copyright 2006 Cedarville University, Benjamin Sprague,
+                     Matt Lewellyn, and David Knierim
+   All rights reserved.
+   For license information see license.txt included with distribution.
+
+   SimMain: Main execution point of cedar-sim, the headless simulator
+*****************************************************************************/
+
+#include "CircuitLoader.h"
+#include "../logic/logic_vector_sim.h"
+#include "../GUI/config.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+
+#ifdef UNIX
+#include <sys/time.h>
+#endif
+
+using namespace std;
+
+// A gate parameter to set at a given time:
+struct Stimulus {
+	TimeType stimTime;
+	IDType gateID;
+	string paramName;
+	string paramValue;
+};
+
+static bool earlierStimulus(const Stimulus &left, const Stimulus &right) {
+	return(left.stimTime < right.stimTime);
+}
+
+// A wire to dump, and the name it was asked for by:
+struct DumpWire {
+	string name;
+	IDType wireID;
+};
+
+// What to run, and how:
+struct SimOptions {
+	string libraryFile;
+	string circuitFile;
+	TimeType ticks;
+	bool quiescent;
+	EngineType engine;
+	unsigned long partitions;
+	unsigned long threads;
+	bool check;
+	bool stats;
+	unsigned long profileGates;
+	string traceFile;
+	string vectorFile;
+	vector < Stimulus > stimuli;
+	vector < string > dumpNames;
+};
+
+static void usage(void) {
+	cerr << "usage: cedar-sim [options] circuit.cdl" << endl
+		<< "  -l, --library FILE     gate library(default " << GATE_LIB << ")" << endl
+		<< "  -t, --ticks N          run for N timesteps(default 1000)" << endl
+		<< "  -q, --quiescent        stop as soon as nothing is left to happen," << endl
+		<< "                         with --ticks as the limit if it is given" << endl
+		<< "  -s, --set T:GATE:PARAM=VALUE" << endl
+		<< "                         set a gate parameter at time T" << endl
+		<< "  -f, --stimulus FILE    read \"T GATE PARAM VALUE\" lines from FILE" << endl
+		<< "  -w, --wire WIRE        dump a wire at the end, by ID or by the name of" << endl
+		<< "                         the TO gate it goes into(\"all\" for every wire)" << endl
+		<< "  -e, --engine NAME      event(default) or levelized" << endl
+		<< "  -p, --partitions N     run the event engine in N partitions" << endl
+		<< "  -j, --threads N        use N threads" << endl
+		<< "  -c, --check            also run the circuit sequentially, and fail if" << endl
+		<< "                         any wire or parameter changes differently" << endl
+		<< "      --stats            print the event engine's step() counters(needs" << endl
+		<< "                         the logic core built with LOGIC_STATS)" << endl
+		<< "      --profile N        time the gate updates, and report the gate types" << endl
+		<< "                         and the N hottest gates on stderr(also needs" << endl
+		<< "                         LOGIC_STATS)" << endl
+		<< "      --trace FILE       write a Chrome trace-event timeline of the run" << endl
+		<< "                         to FILE(also needs LOGIC_STATS)" << endl
+		<< "  -v, --vectors FILE     instead of running the circuit, work out its" << endl
+		<< "                         outputs for each input vector in FILE, which has" << endl
+		<< "                         an \"inputs WIRE...\" line, an \"outputs WIRE...\"" << endl
+		<< "                         line and then a vector per line(bit j of a" << endl
+		<< "                         vector is input j)" << endl;
+}
+
+// Parse "T:GATE:PARAM=VALUE":
+static bool parseStimulus(string text, Stimulus &theStimulus) {
+	unsigned long firstColon = text.find(':');
+	unsigned long secondColon = text.find(':', firstColon + 1);
+	unsigned long equals = text.find('=', secondColon + 1);
+	if(firstColon == string::npos || secondColon == string::npos || equals == string::npos) return false;
+
+	istringstream issTime(text.substr(0, firstColon));
+	istringstream issGate(text.substr(firstColon + 1, secondColon - firstColon - 1));
+	if(!(issTime >> theStimulus.stimTime) || !(issGate >> theStimulus.gateID)) return false;
+	theStimulus.paramName = text.substr(secondColon + 1, equals - secondColon - 1);
+	theStimulus.paramValue = text.substr(equals + 1);
+	return true;
+}
+
+// Read a stimulus file, one "T GATE PARAM VALUE" per line, with # comments:
+static bool readStimulusFile(string fileName, vector < Stimulus > &stimuli) {
+	ifstream inFile(fileName.c_str());
+	if(!inFile) return false;
+	string line;
+	while(getline(inFile, line)) {
+		if(line.find('#') != string::npos) line = line.substr(0, line.find('#'));
+		istringstream iss(line);
+		Stimulus theStimulus;
+		if(!(iss >> theStimulus.stimTime >> theStimulus.gateID >> theStimulus.paramName)) continue;
+		getline(iss, theStimulus.paramValue);
+		unsigned long valueStart = theStimulus.paramValue.find_first_not_of(" \t");
+		theStimulus.paramValue =(valueStart == string::npos) ? "" : theStimulus.paramValue.substr(valueStart);
+		stimuli.push_back(theStimulus);
+	}
+	return true;
+}
+
+static bool parseOptions(int argc, char** argv, SimOptions &options) {
+	options.libraryFile = GATE_LIB;
+	options.ticks = TIME_NONE;
+	options.quiescent = false;
+	options.engine = ENGINE_EVENT;
+	options.partitions = 1;
+	options.threads = 1;
+	options.check = false;
+	options.stats = false;
+	options.profileGates = 0;
+
+	for(int i = 1; i < argc; i++) {
+		string arg = argv[i];
+		bool hasValue =(i + 1 < argc);
+		if((arg == "-q") || (arg == "--quiescent")) {
+			options.quiescent = true;
+		} else if((arg == "-c") || (arg == "--check")) {
+			options.check = true;
+		} else if(arg == "--stats") {
+			options.stats = true;
+		} else if(arg[0] == '-' && arg.size() > 1) {
+			if(!hasValue) return false;
+			string value = argv[++i];
+			istringstream iss(value);
+			if((arg == "-l") || (arg == "--library")) {
+				options.libraryFile = value;
+			} else if((arg == "-t") || (arg == "--ticks")) {
+				if(!(iss >> options.ticks)) return false;
+			} else if((arg == "-s") || (arg == "--set")) {
+				Stimulus theStimulus;
+				if(!parseStimulus(value, theStimulus)) return false;
+				options.stimuli.push_back(theStimulus);
+			} else if((arg == "-f") || (arg == "--stimulus")) {
+				if(!readStimulusFile(value, options.stimuli)) {
+					cerr << "cedar-sim: can't read " << value << endl;
+					return false;
+				}
+			} else if((arg == "-w") || (arg == "--wire")) {
+				options.dumpNames.push_back(value);
+			} else if((arg == "-e") || (arg == "--engine")) {
+				if(value == "event") options.engine = ENGINE_EVENT;
+				else if(value == "levelized") options.engine = ENGINE_LEVELIZED;
+				else return false;
+			} else if((arg == "-p") || (arg == "--partitions")) {
+				if(!(iss >> options.partitions) || options.partitions == 0) return false;
+			} else if((arg == "-j") || (arg == "--threads")) {
+				if(!(iss >> options.threads) || options.threads == 0) return false;
+			} else if(arg == "--trace") {
+				options.traceFile = value;
+			} else if((arg == "-v") || (arg == "--vectors")) {
+				options.vectorFile = value;
+			} else if(arg == "--profile") {
+				if(!(iss >> options.profileGates) || options.profileGates == 0) return false;
+			} else {
+				return false;
+			}
+		} else if(options.circuitFile == "") {
+			options.circuitFile = arg;
+		} else {
+			return false;
+		}
+	}
+	if(options.circuitFile == "") return false;
+
+	// Without --quiescent, run for a fixed time:
+	if(!options.quiescent && options.ticks == TIME_NONE) options.ticks = 1000;
+
+	stable_sort(options.stimuli.begin(), options.stimuli.end(), earlierStimulus);
+	return true;
+}
+
+// The wall clock time in seconds:
+static double wallTime(void) {
+#ifdef UNIX
+	struct timeval now;
+	gettimeofday(&now, NULL);
+	return(double) now.tv_sec +(double) now.tv_usec / 1000000.0;
+#else
+	return(double) clock() /(double) CLOCKS_PER_SEC;
+#endif
+}
+
+// Find a wire by the name of the TO gate it goes into, or by its ID. Returns
+// ID_NONE if there isn't one:
+static IDType findWire(CircuitLoader &loader, string name) {
+	IDType wireID = loader.findNamedWire(name);
+	if(wireID == ID_NONE) {
+		istringstream iss(name);
+		if(!(iss >> wireID)) wireID = ID_NONE;
+	}
+	return wireID;
+}
+
+// Read a vector file: the input and output wires, and then the vectors, in
+// decimal or in hex with a 0x, with # comments:
+static bool readVectorFile(string fileName, vector < string > &inputNames, vector < string > &outputNames, vector < unsigned long long > &vectors) {
+	ifstream inFile(fileName.c_str());
+	if(!inFile) return false;
+	string line;
+	while(getline(inFile, line)) {
+		if(line.find('#') != string::npos) line = line.substr(0, line.find('#'));
+		istringstream iss(line);
+		string word;
+		if(!(iss >> word)) continue;
+		if(word == "inputs" || word == "outputs") {
+			vector < string > &names =(word == "inputs") ? inputNames : outputNames;
+			while(iss >> word) names.push_back(word);
+			continue;
+		}
+		istringstream issVector(word);
+		unsigned long long theVector;
+		if(!(issVector >> setbase(0) >> theVector)) return false;
+		vectors.push_back(theVector);
+	}
+	return true;
+}
+
+// Run the input vectors in a vector file through the circuit with the
+// VectorSimulator, VECTOR_LANES at a time, and print each one's outputs:
+static int runVectors(Circuit* cir, CircuitLoader &loader, string fileName) {
+	vector < string > inputNames, outputNames;
+	vector < unsigned long long > vectors;
+	if(!readVectorFile(fileName, inputNames, outputNames, vectors)) {
+		cerr << "cedar-sim: can't read the vectors in " << fileName << endl;
+		return 1;
+	}
+	if(inputNames.size() > 64 || outputNames.size() > 64) {
+		cerr << "cedar-sim: a vector can only have 64 inputs and 64 outputs" << endl;
+		return 1;
+	}
+	vector < IDType > inputWires, outputWires;
+	for(unsigned long i = 0; i < inputNames.size() + outputNames.size(); i++) {
+		bool isInput =(i < inputNames.size());
+		string name = isInput ? inputNames[i] : outputNames[i - inputNames.size()];
+		IDType wireID = findWire(loader, name);
+		if(wireID == ID_NONE) {
+			cerr << "cedar-sim: there is no wire " << name << endl;
+			return 1;
+		}
+		(isInput ? inputWires : outputWires).push_back(wireID);
+	}
+
+	VectorSimulator vsim(cir);
+	if(!vsim.compile(inputWires)) {
+		cerr << "cedar-sim: the circuit has gates that can't be run on vectors" << endl;
+		return 1;
+	}
+	double startTime = wallTime();
+	vector < unsigned long long > results;
+	for(unsigned long first = 0; first < vectors.size(); first += VECTOR_LANES) {
+		vector < unsigned long long > batch(vectors.begin() + first, vectors.begin() + min(first + VECTOR_LANES,(unsigned long) vectors.size()));
+		vsim.loadInputVectors(batch);
+		vsim.evaluate();
+		vector < unsigned long long > batchResults = vsim.getOutputVectors(outputWires, batch.size());
+		results.insert(results.end(), batchResults.begin(), batchResults.end());
+	}
+	double runTime = wallTime() - startTime;
+
+	cout << hex;
+	for(unsigned long i = 0; i < vectors.size(); i++) {
+		cout << "vector 0x" << vectors[i] << " 0x" << results[i] << endl;
+	}
+	cout << dec << "vectors " << vectors.size() << endl;
+	cout << "seconds " << runTime << endl;
+	return 0;
+}
+
+static char stateChar(StateType state) {
+	switch(state) {
+	case ZERO: return '0';
+	case ONE: return '1';
+	case HI_Z: return 'Z';
+	case CONFLICT: return 'C';
+	default: return 'X';
+	}
+}
+
+// Run the circuit through the stimuli until the end time, or until it goes
+// quiet. The states of all of the wires are taken at each stimulus time and at
+// the end, for --check:
+static void runCircuit(Circuit* cir, const SimOptions &options, const vector < IDType > &wireIDs, vector < StateType > &snapshots) {
+	unsigned long nextStimulus = 0;
+	while(true) {
+		// Set the parameters that are due:
+		while(nextStimulus < options.stimuli.size() && options.stimuli[nextStimulus].stimTime <= cir->getSystemTime()) {
+			const Stimulus &theStimulus = options.stimuli[nextStimulus++];
+			cir->setGateParameter(theStimulus.gateID, theStimulus.paramName, theStimulus.paramValue);
+			for(unsigned long i = 0; i < wireIDs.size(); i++) snapshots.push_back(cir->getWireState(wireIDs[i]));
+		}
+		if(options.ticks != TIME_NONE && cir->getSystemTime() >= options.ticks) break;
+
+		TimeType runTo = options.ticks;
+		if(nextStimulus < options.stimuli.size()) runTo = min(runTo, options.stimuli[nextStimulus].stimTime);
+
+		if(options.quiescent) {
+			// Step through the busy times one at a time, to stop as soon as
+			// nothing is left, but jump over the quiet time to a stimulus:
+			TimeType nextActive = cir->getNextActiveTime();
+			if(nextActive == TIME_NONE && nextStimulus == options.stimuli.size()) break;
+			if(nextActive != TIME_NONE && nextActive < runTo) runTo = nextActive + 1;
+		}
+		cir->runUntil(runTo);
+
+		// Nothing reads the parameter changes, so don't let them pile up:
+		cir->clearParamUpdateList();
+	}
+	for(unsigned long i = 0; i < wireIDs.size(); i++) snapshots.push_back(cir->getWireState(wireIDs[i]));
+}
+
+// Print the step() counters:
+static void printStats(Circuit* cir) {
+	const CircuitStats &stats = cir->getTotalStats();
+	cout << "stats steps " << stats.steps << endl;
+	cout << "stats events_popped " << stats.eventsPopped << endl;
+	cout << "stats events_cancelled " << stats.eventsCancelled << endl;
+	cout << "stats queue_high_water " << stats.queueHighWater << endl;
+	cout << "stats groups_walked " << stats.groupsWalked << endl;
+	cout << "stats wires_resolved " << stats.wiresResolved << endl;
+	cout << "stats gates_evaluated " << stats.gatesEvaluated << endl;
+	for(unsigned long i = 0; i < stats.gatesByType.size(); i++) {
+		cout << "stats gates " << cir->getGateTypeNames()[i] << " " << stats.gatesByType[i] << endl;
+	}
+	for(unsigned long i = 0; i < STATS_PHASE_COUNT; i++) {
+		cout << "stats seconds " << statsPhaseNames[i] << " " << stats.phaseTime[i] << endl;
+	}
+}
+
+int main(int argc, char** argv) {
+	SimOptions options;
+	if(!parseOptions(argc, argv, options)) {
+		usage();
+		return 1;
+	}
+
+	CircuitLoader loader;
+	if(!loader.loadLibrary(options.libraryFile)) {
+		cerr << "cedar-sim: can't read the library " << options.libraryFile << endl;
+		return 1;
+	}
+
+	Circuit* cir = new Circuit();
+	if(!loader.loadCircuit(options.circuitFile, cir)) {
+		cerr << "cedar-sim: can't read the circuit " << options.circuitFile << endl;
+		return 1;
+	}
+	for(unsigned long i = 0; i < loader.getWarnings().size(); i++) {
+		cerr << "cedar-sim: warning: " << loader.getWarnings()[i] << endl;
+	}
+	if(options.vectorFile != "") {
+		int result = runVectors(cir, loader, options.vectorFile);
+		delete cir;
+		return result;
+	}
+	cir->setEngine(options.engine);
+	cir->setThreadCount(options.threads);
+	cir->setPartitionCount(options.partitions);
+	vector < LoggedChange > changeLog;
+	if(options.check) cir->setChangeLog(&changeLog);
+	if(options.stats) {
+		cir->setStatsEnabled(true);
+		if(!cir->getStatsEnabled()) cerr << "cedar-sim: warning: the logic core was built without LOGIC_STATS" << endl;
+	}
+	if(options.profileGates > 0) {
+		cir->setProfiling(true);
+		if(!cir->getProfiling()) cerr << "cedar-sim: warning: the logic core was built without LOGIC_STATS" << endl;
+	}
+
+	// Find the wires to dump:
+	vector < DumpWire > dumpWires;
+	for(unsigned long i = 0; i < options.dumpNames.size(); i++) {
+		if(options.dumpNames[i] == "all") {
+			for(unsigned long j = 0; j < loader.getWireIDs().size(); j++) {
+				ostringstream oss;
+				oss << loader.getWireIDs()[j];
+				DumpWire theWire = { oss.str(), loader.getWireIDs()[j] };
+				dumpWires.push_back(theWire);
+			}
+			continue;
+		}
+		DumpWire theWire = { options.dumpNames[i], findWire(loader, options.dumpNames[i]) };
+		if(theWire.wireID == ID_NONE) {
+			cerr << "cedar-sim: there is no wire " << options.dumpNames[i] << endl;
+			return 1;
+		}
+		dumpWires.push_back(theWire);
+	}
+
+	vector < StateType > snapshots;
+	traceThreadName("cedar-sim");
+	if(options.traceFile != "") traceStart();
+	double startTime = wallTime();
+	runCircuit(cir, options, loader.getWireIDs(), snapshots);
+	double runTime = wallTime() - startTime;
+	if(options.traceFile != "") {
+		traceStop();
+		if(!traceWrite(options.traceFile)) cerr << "cedar-sim: can't write " << options.traceFile << endl;
+	}
+
+	for(unsigned long i = 0; i < dumpWires.size(); i++) {
+		cout << "wire " << dumpWires[i].name << " " << stateChar(cir->getWireState(dumpWires[i].wireID)) << endl;
+	}
+	cout << "time " << cir->getSystemTime() << endl;
+	cout << "events " << cir->getEventCount() << endl;
+	cout << "seconds " << runTime << endl;
+	cout << "events/sec " <<((runTime > 0) ?(double) cir->getEventCount() / runTime : 0) << endl;
+	if(cir->getStatsEnabled()) printStats(cir);
+	if(cir->getProfiling()) writeProfileReport(cerr, cir->getGateTypeProfile(), cir->getGateProfile(), options.profileGates);
+
+	int result = 0;
+	if(options.check) {
+		// Run the circuit again on the sequential event engine:
+		Circuit* checkCir = new Circuit();
+		CircuitLoader checkLoader;
+		checkLoader.loadLibrary(options.libraryFile);
+		checkLoader.loadCircuit(options.circuitFile, checkCir);
+
+		vector < StateType > checkSnapshots;
+		vector < LoggedChange > checkLog;
+		checkCir->setChangeLog(&checkLog);
+		runCircuit(checkCir, options, checkLoader.getWireIDs(), checkSnapshots);
+
+		const vector < IDType > &wireIDs = loader.getWireIDs();
+		unsigned long mismatches = 0;
+		for(unsigned long i = 0; i < snapshots.size() && i < checkSnapshots.size(); i++) {
+			if(snapshots[i] == checkSnapshots[i]) continue;
+			if(mismatches++ < 10) {
+				cerr << "cedar-sim: wire " << wireIDs[i % wireIDs.size()] << " is " << stateChar(snapshots[i])
+					<< ", not " << stateChar(checkSnapshots[i]) << ", at snapshot " << i / wireIDs.size() << endl;
+			}
+		}
+		if(snapshots.size() != checkSnapshots.size() || cir->getSystemTime() != checkCir->getSystemTime()) mismatches++;
+
+		// And every change along the way:
+		mismatches += compareChangeLogs(changeLog, checkLog, cerr,(mismatches < 10) ? 10 - mismatches : 0);
+		cout << "check " <<((mismatches == 0) ? "passed" : "failed") << endl;
+		if(mismatches > 0) result = 2;
+		delete checkCir;
+	}
+
+	delete cir;
+	return result;
+}